@@ -17,6 +17,9 @@ class RangeValues(FunctionAnalysis):
 
     It is flow insensitif and aliasing is not taken into account as integer
     doesn't create aliasing in Python.
+
+    The result maps variable names to their range, and the index of
+    subscripts (or each element of a tuple index) to the range of the index.
     """
 
     def __init__(self):
@@ -55,6 +58,39 @@ class RangeValues(FunctionAnalysis):
         for stmt in node.body:
             self.visit(stmt)
 
+        self.visit_indices(node)
+
+    def visit_indices(self, node):
+        """ Store the range of each subscript index.
+
+        It is computed once variable ranges are known for the whole function,
+        as the analyse is flow insensitive.
+
+        >>> import gast as ast
+        >>> from pythran import passmanager, backend
+        >>> node = ast.parse('''
+        ... def foo(a):
+        ...     for i in __builtin__.range(1, 10):
+        ...         a[i - 1] = a[i + 1, i - 2]''')
+        >>> pm = passmanager.PassManager("test")
+        >>> res = pm.gather(RangeValues, node)
+        >>> stmt = node.body[0].body[0].body[0]
+        >>> res[stmt.targets[0].slice.value]
+        Range(low=0, high=9)
+        >>> [res[elt] for elt in stmt.value.slice.value.elts]
+        [Range(low=2, high=11), Range(low=-1, high=8)]
+        """
+        for subscript in ast.walk(node):
+            if not (isinstance(subscript, ast.Subscript) and
+                    isinstance(subscript.slice, ast.Index)):
+                continue
+            index = subscript.slice.value
+            if isinstance(index, ast.Tuple):
+                for elt in index.elts:
+                    self.result[elt] = self.visit(elt)
+            else:
+                self.result[index] = self.visit(index)
+
     def visit_Assign(self, node):
         """
         Set range value for assigned variable.
@@ -148,11 +184,19 @@ class RangeValues(FunctionAnalysis):
         >>> res['c']
         Range(low=2, high=2)
         """
-        old_range = copy.deepcopy(self.result)
-        for stmt in node.body:
-            self.visit(stmt)
-        for name, range_ in old_range.items():
-            self.result[name].widen(range_)
+        # iterate until ranges are stable, so that a variable assigned from
+        # another one is widened along with it. Ranges only grow and widen to
+        # infinity, which guarantees termination.
+        while True:
+            old_range = copy.deepcopy(self.result)
+            for stmt in node.body:
+                self.visit(stmt)
+            for name, range_ in old_range.items():
+                self.result[name].widen(range_)
+            if all(name in old_range and
+                   tuple(range_) == tuple(old_range[name])
+                   for name, range_ in self.result.items()):
+                break
         for stmt in node.orelse:
             self.visit(stmt)
 
@@ -303,8 +347,11 @@ class RangeValues(FunctionAnalysis):
             return UNKNOWN_RANGE
 
     def visit_Name(self, node):
-        """ Get range for parameters for examples or false branching. """
-        return self.result[node.id]
+        """ Get range for parameters for examples or false branching.
+
+        A variable not assigned yet, as in a loop body, can hold any value.
+        """
+        return self.result.get(node.id, UNKNOWN_RANGE)
 
     def visit_ExceptHandler(self, node):
         """ Add a range value for exception variable.
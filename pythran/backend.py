@@ -174,6 +174,8 @@ pythonic::types::none_type>::type result_type;
     # recover previous generator state
     generator_state_holder = "__generator_state"
     generator_state_value = "__generator_value"
+    # runs the generator up to its next value, returns false once exhausted
+    generator_step = "__generator_step"
     # flags the last statement of a generator
     final_statement = "that_is_all_folks"
 
@@ -368,11 +370,11 @@ pythonic::types::none_type>::type result_type;
                     ", ".join(formal_types)) if formal_types else "")
 
             operator_body.append(
-                Statement("{0}: return result_type();".format(
+                Statement("{0}: return false".format(
                     Cxx.final_statement)))
 
             next_declaration = [
-                FunctionDeclaration(Value("result_type", "next"), []),
+                FunctionDeclaration(Value("bool", Cxx.generator_step), []),
                 EmptyStatement()]  # empty statement to force a comma ...
 
             # the constructors
@@ -395,10 +397,23 @@ pythonic::types::none_type>::type result_type;
                                    for arg in formal_args])))
                     ))
 
+            # iteration reads the state, only an explicit call to next()
+            # on an exhausted generator raises StopIteration
             next_iterator = [
                 FunctionBody(
                     FunctionDeclaration(Value("void", "operator++"), []),
-                    Block([Statement("next()")])),
+                    Block([Statement("{0}()".format(Cxx.generator_step))])),
+                FunctionBody(
+                    FunctionDeclaration(
+                        Value("typename {0}::result_type".format(
+                            instanciated_next_name),
+                            "next"),
+                        []),
+                    Block([
+                        If("not {0}()".format(Cxx.generator_step),
+                           Statement(
+                               "throw pythonic::types::StopIteration()")),
+                        ReturnStatement(Cxx.generator_state_value)])),
                 FunctionBody(
                     FunctionDeclaration(
                         Value("typename {0}::result_type".format(
@@ -414,7 +429,7 @@ pythonic::types::none_type>::type result_type;
                               .format(next_name),
                               "begin"),
                         []),
-                    Block([Statement("next()"),
+                    Block([Statement("{0}()".format(Cxx.generator_step)),
                            ReturnStatement(
                                "pythonic::types::generator_iterator<{0}>"
                                "(*this)".format(next_name))])),
@@ -431,20 +446,22 @@ pythonic::types::none_type>::type result_type;
             next_signature = templatize(
                 FunctionDeclaration(
                     Value(
-                        "typename {0}::result_type".format(
-                            instanciated_next_name),
-                        "{0}::next".format(instanciated_next_name)),
+                        "bool",
+                        "{0}::{1}".format(instanciated_next_name,
+                                          Cxx.generator_step)),
                     []),
                 formal_types)
 
             next_body = operator_body
-            # the dispatch table at the entry point
+            # the dispatch table at the entry point, an exhausted generator
+            # stays exhausted
             next_body.insert(0, Statement("switch({0}) {{ {1} }}".format(
                 Cxx.generator_state_holder,
                 " ".join("case {0}: goto {1};".format(num, where)
                          for (num, where) in sorted(
                              self.yields.values(),
-                             key=lambda x: x[0])))))
+                             key=lambda x: x[0]) +
+                         [(-1, Cxx.final_statement)]))))
 
             ctx = CachedTypeVisitor(self.lctx)
             next_members = ([Statement("{0} {1}".format(ft, fa))
@@ -617,9 +634,8 @@ pythonic::types::none_type>::type result_type;
         num, label = self.yields[node]
         return "".join(n for n in Block([
             Assign(Cxx.generator_state_holder, num),
-            ReturnStatement("{0} = {1}".format(
-                Cxx.generator_state_value,
-                self.visit(node.value))),
+            Assign(Cxx.generator_state_value, self.visit(node.value)),
+            ReturnStatement("true"),
             Statement("{0}:".format(label))
             ]).generate())
 
@@ -1234,6 +1250,15 @@ pythonic::types::none_type>::type result_type;
             sattr += '{}'
         return sattr
 
+    def is_positive_index(self, index):
+        """ Whether `index' is known to be positive, in which case the
+        subscript needs no bound wrapping. Tuple indices must be positive in
+        every dimension. """
+        if isinstance(index, ast.Tuple):
+            return all(self.is_positive_index(elt) for elt in index.elts)
+        return (index in self.range_values and
+                self.range_values[index].low >= 0)
+
     def visit_Subscript(self, node):
         value = self.visit(node.value)
         # we cannot overload the [] operator in that case
@@ -1258,8 +1283,7 @@ pythonic::types::none_type>::type result_type;
             return "{1}({0})".format(','.join(slice_), value)
         # positive indexing case
         elif (isinstance(node.slice, ast.Index) and
-              isinstance(node.slice.value, ast.Name) and
-              self.range_values[node.slice.value.id].low >= 0):
+              self.is_positive_index(node.slice.value)):
             slice_ = self.visit(node.slice)
             return "{1}.fast({0})".format(slice_, value)
         # standard case
@@ -0,0 +1,319 @@
+'''
+This module contains a persistent cache of the compiled modules.
+
+A module is stored under a hash of everything its build depends on: the
+Python source, the specs, the optimizations, the pythonic headers, the
+compiler and its flags, and the configuration. Compiling the same input
+again then reuses the stored binary without generating nor compiling C++.
+
+It also manages precompiled headers for the includes shared by all modules.
+'''
+
+from pythran.config import cfg
+from pythran.types.conversion import pytype_to_ctype
+from pythran.version import __version__
+
+from distutils import sysconfig
+from distutils.errors import CompileError
+import numpy.distutils.ccompiler
+import numpy
+
+from tempfile import mkdtemp, mkstemp
+import hashlib
+import json
+import logging
+import os.path
+import shutil
+import subprocess
+import sys
+
+logger = logging.getLogger('pythran')
+
+# environment variables honored by distutils when compiling
+COMPILER_ENVIRONMENT = ('CC', 'CXX', 'CPPFLAGS', 'CFLAGS', 'CXXFLAGS',
+                        'LDFLAGS', 'LDSHARED', 'ARCHFLAGS')
+
+
+def enabled():
+    return cfg.getboolean('cache', 'enabled')
+
+
+def cache_dir():
+    ''' Root of the cache, created if needed. '''
+    path = cfg.get('cache', 'dir')
+    if not path:
+        path = os.path.join(os.environ.get('XDG_CACHE_HOME', '~/.cache'),
+                            'pythran')
+    path = os.path.expanduser(path)
+    _makedirs(path)
+    return path
+
+
+def _hash_update(sha, *values):
+    sha.update(json.dumps(values, sort_keys=True, default=repr)
+               .encode('utf-8'))
+
+
+def _hash_tree(root, suffixes=None, skip=()):
+    ''' Hash of the files under `root', or of those ending with one of
+    `suffixes', along with their relative paths. Directories named in `skip'
+    are ignored. '''
+    sha = hashlib.sha256()
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames[:] = sorted(d for d in dirnames if d not in skip)
+        for filename in sorted(filenames):
+            if suffixes and not filename.endswith(suffixes):
+                continue
+            path = os.path.join(dirpath, filename)
+            sha.update(os.path.relpath(path, root).encode('utf-8'))
+            with open(path, 'rb') as source:
+                sha.update(source.read())
+    return sha.hexdigest()
+
+
+_pythonic_hash = []
+
+
+def pythonic_hash():
+    ''' Hash of the pythonic header tree, computed once per process. '''
+    if not _pythonic_hash:
+        root = os.path.join(os.path.dirname(__file__), 'pythonic')
+        _pythonic_hash.append(_hash_tree(root))
+    return _pythonic_hash[0]
+
+
+_pythran_hash = []
+
+
+def pythran_hash():
+    '''
+    Hash of the Python sources of pythran, computed once per process, so
+    that development or editable installs do not reuse binaries built by
+    other versions of the passes or of the backend.
+    '''
+    if not _pythran_hash:
+        root = os.path.dirname(os.path.abspath(__file__))
+        _pythran_hash.append(_hash_tree(root, ('.py',),
+                                        skip=('pythonic', 'tests')))
+    return _pythran_hash[0]
+
+
+_cxx_compiler = []
+
+
+def cxx_compiler():
+    ''' The compiler used by distutils to build C++ extensions. '''
+    if not _cxx_compiler:
+        compiler = numpy.distutils.ccompiler.new_compiler()
+        compiler.customize(None, need_cxx=True)
+        _cxx_compiler.append(compiler.cxx_compiler())
+    return _cxx_compiler[0]
+
+
+_compiler_identity = []
+
+
+def compiler_identity():
+    ''' Command lines and version of the C++ compiler. '''
+    if not _compiler_identity:
+        compiler = cxx_compiler()
+        commands = [getattr(compiler, attr, None)
+                    for attr in ('compiler_so', 'compiler_cxx', 'linker_so')]
+        try:
+            version = subprocess.check_output(
+                [compiler.compiler_so[0], '--version'],
+                stderr=subprocess.STDOUT).decode('utf-8', 'replace')
+        except (OSError, subprocess.CalledProcessError) as e:
+            version = str(e)
+        _compiler_identity.append((commands, version))
+    return _compiler_identity[0]
+
+
+def extension_suffix():
+    ''' Extension of the binaries, as set by toolchain.compile_cxxfile. '''
+    suffix = (sysconfig.get_config_var('EXT_SUFFIX') or
+              sysconfig.get_config_var('SO'))
+    return '.' + suffix.rsplit('.', 1)[-1]
+
+
+def build_key(module_name, code, specs, optimizations, extension):
+    '''
+    Hash of all the inputs of a module build. `extension' holds the
+    resolved compiler options, as returned by config.make_extension.
+
+    Returns None for specs that cannot be converted, the error is then
+    reported by the actual build.
+    '''
+    try:
+        signatures = sorted(
+            (name, [(type(signature).__name__,
+                     [pytype_to_ctype(t) for t in signature])
+                    for signature in (sigs if isinstance(sigs, tuple)
+                                      else (sigs,))])
+            for name, sigs in specs.items())
+    except NotImplementedError:
+        return None
+    sha = hashlib.sha256()
+    _hash_update(sha,
+                 __version__, pythran_hash(), sys.version, extension_suffix(),
+                 numpy.__version__, pythonic_hash(), compiler_identity(),
+                 dict((var, os.environ.get(var))
+                      for var in COMPILER_ENVIRONMENT),
+                 dict((section, dict(cfg.items(section)))
+                      for section in cfg.sections()),
+                 module_name, signatures, optimizations, extension)
+    sha.update(code.encode('utf-8'))
+    return sha.hexdigest()
+
+
+def _entry(key):
+    return os.path.join(cache_dir(), 'modules', key[:2], key)
+
+
+def _record(event, seconds):
+    ''' Append `event' to the cache statistics, along with the build time
+    it cost (miss) or saved (hit). '''
+    with open(os.path.join(cache_dir(), 'stats'), 'a') as stats:
+        stats.write('{} {:.3f}\n'.format(event, seconds))
+
+
+def lookup(key, module_name, output_binary=None):
+    '''
+    Copy the binary stored under `key' to `output_binary', defaulting to
+    the current directory. Returns the path to the copy, or None if `key' is
+    not in the cache.
+    '''
+    entry = _entry(key)
+    if not output_binary:
+        output_binary = os.path.join(os.getcwd(),
+                                     module_name + extension_suffix())
+    try:
+        with open(entry + '.json') as info:
+            build_time = json.load(info)['build_time']
+        shutil.copy(entry + extension_suffix(), output_binary)
+    except (EnvironmentError, ValueError, KeyError):
+        logger.info("Build cache miss for " + module_name)
+        return None
+    _record('hit', build_time)
+    logger.info("Build cache hit for {}, saved {:.1f}s".format(module_name,
+                                                               build_time))
+    logger.info("Output: " + output_binary)
+    return output_binary
+
+
+def _replace(src, dst):
+    ''' Move `src' to `dst' in a single step, so that concurrent readers
+    never see a partial file. '''
+    try:
+        os.rename(src, dst)
+    except OSError:  # Windows does not replace existing files
+        os.remove(src)
+
+
+def _atomic_copy(src, dst):
+    fd, tmp = mkstemp(dir=os.path.dirname(dst))
+    os.close(fd)
+    shutil.copy(src, tmp)
+    _replace(tmp, dst)
+
+
+def _makedirs(path):
+    if not os.path.isdir(path):
+        try:
+            os.makedirs(path)
+        except OSError:  # concurrently created
+            pass
+
+
+def store(key, module_name, binary, build_time):
+    ''' Store `binary', which took `build_time' seconds to build, under
+    `key'. '''
+    entry = _entry(key)
+    _makedirs(os.path.dirname(entry))
+    _atomic_copy(binary, entry + extension_suffix())
+    # the metadata marks the entry as complete, so it comes last
+    fd, tmp = mkstemp(dir=os.path.dirname(entry))
+    with os.fdopen(fd, 'w') as info:
+        json.dump({'module': module_name, 'build_time': build_time}, info)
+    _replace(tmp, entry + '.json')
+    _record('miss', build_time)
+
+
+def stats():
+    ''' Number of hits and misses, time saved by hits and time spent on
+    misses, in seconds. '''
+    result = {'hit': 0, 'miss': 0, 'saved': 0., 'spent': 0.}
+    try:
+        with open(os.path.join(cache_dir(), 'stats')) as lines:
+            for line in lines:
+                event, seconds = line.split()
+                result[event] += 1
+                result['saved' if event == 'hit' else 'spent'] += float(
+                    seconds)
+    except (IOError, OSError):
+        pass
+    return result
+
+
+def clear():
+    shutil.rmtree(cache_dir())
+
+
+def precompiled_header(header, extension):
+    '''
+    Precompile the C++ code `header' with the compiler options in
+    `extension', and return the compiler flags that make a translation unit
+    start with it.
+
+    Only gcc is supported, an empty list is returned for other compilers.
+    gcc silently falls back to the plain header if the precompiled one does
+    not match the translation unit flags, so this is always safe. gcc also
+    requires the precompiled header to be the first one included, so an
+    empty list is returned as well if the flags already use -include.
+    '''
+    if any(arg.startswith('-include')
+           for arg in extension['extra_compile_args']):
+        logger.info("Precompiled headers are disabled by -include")
+        return []
+
+    commands, version = compiler_identity()
+    if 'Free Software Foundation' not in version or 'clang' in version:
+        logger.info("Precompiled headers are only supported with gcc")
+        return []
+
+    sha = hashlib.sha256()
+    _hash_update(sha, __version__, pythonic_hash(), commands, version,
+                 header, extension)
+    pch_dir = os.path.join(cache_dir(), 'pch', sha.hexdigest())
+    pch_header = os.path.join(pch_dir, 'pythran_pch.hpp')
+    flags = ['-include', pch_header]
+    if os.path.exists(pch_header + '.gch'):
+        return flags
+
+    logger.info("Precompiling headers in " + pch_dir)
+    builddir = mkdtemp()
+    try:
+        source = os.path.join(builddir, 'pythran_pch.cpp')
+        with open(source, 'w') as out:
+            out.write(header)
+        include_dirs = (extension['include_dirs'] +
+                        [numpy.get_include(),
+                         sysconfig.get_python_inc(),
+                         sysconfig.get_python_inc(plat_specific=1)])
+        macros = (extension['define_macros'] +
+                  [(undef,) for undef in extension['undef_macros']])
+        [pch] = cxx_compiler().compile(
+            [source], output_dir=builddir, macros=macros,
+            include_dirs=include_dirs,
+            extra_preargs=['-x', 'c++-header'],
+            extra_postargs=extension['extra_compile_args'])
+        _makedirs(pch_dir)
+        # the header must be there before its precompiled version is
+        _atomic_copy(source, pch_header)
+        _atomic_copy(pch, pch_header + '.gch')
+    except (CompileError, EnvironmentError) as e:
+        logger.warn("Failed to precompile headers: " + str(e))
+        return []
+    finally:
+        shutil.rmtree(builddir)
+    return flags
@@ -113,6 +113,7 @@ def run():
     import distutils.sysconfig
     import pythran
     import numpy
+    from pythran import cache
 
     parser = argparse.ArgumentParser(
         prog='pythran-config',
@@ -129,10 +130,24 @@ def run():
     parser.add_argument('--libs', action='store_true',
                         help='print linker flags')
 
+    parser.add_argument('--cache-stats', action='store_true',
+                        help='print build cache hits and misses')
+
+    parser.add_argument('--clear-cache', action='store_true',
+                        help='empty the build cache')
+
     args = parser.parse_args(sys.argv[1:])
 
     output = []
 
+    if args.cache_stats:
+        stats = cache.stats()
+        print('{hit} hits, {saved:.1f}s saved\n'
+              '{miss} misses, {spent:.1f}s spent'.format(**stats))
+
+    if args.clear_cache:
+        cache.clear()
+
     extension = pythran.config.make_extension()
 
     if args.compiler:
@@ -509,7 +509,7 @@ class PythonModule(object):
     def add_meta(self, infos):
         self.infos = infos
 
-    def add_function(self, func, name, types):
+    def add_function(self, func, name, types, release_gil=False):
         """
         Add a function to be exposed. *func* is expected to be a
         :class:`cgen.FunctionBody`.
@@ -518,6 +518,10 @@ class PythonModule(object):
         this method actually creates a wrapper for each specialization
         and a global wrapper that checks the argument types and
         runs the correct candidate, if any
+
+        If *release_gil* is set, the arguments are converted first, then the
+        GIL is released while *func* runs, and reacquired before converting
+        its result or translating its exceptions.
         """
         self.implems.append(func)
 
@@ -528,16 +532,28 @@ class PythonModule(object):
         for i, t in enumerate(types):
             args_unboxing.append('from_python<{}>(args_obj[{}])'.format(t, i))
             args_checks.append('is_convertible<{}>(args_obj[{}])'.format(t, i))
+        if release_gil:
+            # the converted arguments live in the wrapper, so that the
+            # function never drops the last reference to a Python object
+            body = ['auto&& a{} = {};'.format(i, unboxing)
+                    for i, unboxing in enumerate(args_unboxing)]
+            body.append('return to_python(pythonic::call_without_gil({}));'
+                        .format(', '.join([func.fdecl.name] +
+                                          ['a{}'.format(i)
+                                           for i in range(len(types))])))
+        else:
+            body = ['return to_python({}({}));'.format(
+                func.fdecl.name, ', '.join(args_unboxing))]
         if types:
             wrapper = dedent('''
                 static PyObject *
-                {wname}(PyObject *self, PyObject *args)
+                {wname}(PyObject *const *args_obj, Py_ssize_t nargs)
                 {{
-                    PyObject* args_obj[{size}+1];
-                    if(! PyArg_ParseTuple(args, "{fmt}", {objs}))
+                    if(nargs != {size})
                         return nullptr;
-                    if({checks})
-                        return to_python({name}({args}));
+                    if({checks}) {{
+                        {body}
+                    }}
                     else {{
                         return nullptr;
                     }}
@@ -545,19 +561,17 @@ class PythonModule(object):
         else:
             wrapper = dedent('''
                 static PyObject *
-                {wname}(PyObject *self, PyObject *args)
+                {wname}(PyObject *const *args_obj, Py_ssize_t nargs)
                 {{
-                    return to_python({name}({args}));
+                    if(nargs != 0)
+                        return nullptr;
+                    {body}
                 }}''')
 
         self.wrappers.append(
-            wrapper.format(name=func.fdecl.name,
-                           size=len(types),
-                           fmt="O" * len(types),
-                           objs=', '.join('&args_obj[%d]' % i
-                                          for i in range(len(types))),
-                           args=', '.join(args_unboxing),
+            wrapper.format(size=len(types),
                            checks=' and '.join(args_checks),
+                           body=('\n' + ' ' * (8 if types else 4)).join(body),
                            wname=wrapper_name,
                            )
         )
@@ -582,14 +596,8 @@ class PythonModule(object):
                 'PyModule_AddObject(theModule, "{0}", {0});'.format(vname))
 
         for fname, overloads in self.functions.items():
-            tryall = []
             candidates = []
             for overload, types in overloads:
-                try_ = dedent("""
-                    if(PyObject* obj = {name}(self, args))
-                        return obj;
-                    """.format(name=overload))
-                tryall.append(try_)
                 theargs = (t.replace("pythonic::types::", "")
                             .replace('::', '.')
                            for t in types)
@@ -598,14 +606,37 @@ class PythonModule(object):
                 candidates.append(thecall)
 
             wrapper_name = pythran_ward + 'wrapall_' + fname
+            dispatcher_name = pythran_ward + 'dispatch_' + fname
+
+            if len(overloads) == 1:
+                dispatch = dedent("""
+                    if(PyObject* obj = {name}(args_obj, nargs))
+                        return obj;
+                    """.format(name=overloads[0][0]))
+            else:
+                # remember the overload matching each argument types
+                # fingerprint, so that it is tried first on later calls
+                dispatch = dedent("""
+                    static pythonic::python::dispatch_cache<{size}> cache;
+                    static PyObject *(*const overloads[])(PyObject *const *,
+                                                          Py_ssize_t) = {{
+                        {overloads}
+                    }};
+                    if(PyObject* obj = pythonic::python::dispatch(
+                           cache, overloads, args_obj, nargs))
+                        return obj;
+                    """.format(size=1 << (2 * len(overloads) - 1).bit_length(),
+                               overloads=", ".join(overload
+                                                   for overload, _ in
+                                                   overloads)))
 
             candidate = dedent('''
             static PyObject *
-            {wname}(PyObject *self, PyObject *args)
+            {dname}(PyObject *const *args_obj, Py_ssize_t nargs)
             {{
-                return pythonic::handle_python_exception([self, args]()
+                return pythonic::handle_python_exception([args_obj, nargs]()
                 -> PyObject* {{
-                {tryall}
+                {dispatch}
                 PyErr_SetString(PyExc_TypeError,
                 "Invalid argument type for pythranized function `{name}'.\\n"
                 "Candidates are:\\n{candidates}\\n"
@@ -613,16 +644,31 @@ class PythonModule(object):
                 return nullptr;
                 }});
             }}
+            #if PYTHRAN_FASTCALL
+            static PyObject *
+            {wname}(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+            {{
+                return {dname}(args, nargs);
+            }}
+            #else
+            static PyObject *
+            {wname}(PyObject *self, PyObject *args)
+            {{
+                return {dname}(&PyTuple_GET_ITEM(args, 0),
+                               PyTuple_GET_SIZE(args));
+            }}
+            #endif
             '''.format(name=fname,
-                       tryall="\n".join(tryall),
+                       dispatch=dispatch,
                        candidates="\\n".join("   " + c for c in candidates),
+                       dname=dispatcher_name,
                        wname=wrapper_name))
 
             fdoc = self.docstring(self.docstrings.get(fname, ''))
             themethod = dedent('''{{
                 "{name}",
-                {wname},
-                METH_VARARGS,
+                (PyCFunction)(void (*)(void)){wname},
+                PYTHRAN_METH_ARGS,
                 {doc}}}'''.format(name=fname,
                                   wname=wrapper_name,
                                   doc=fdoc))
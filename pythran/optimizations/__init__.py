@@ -12,6 +12,7 @@ import optimisations.xxxxx
 
 from .constant_folding import ConstantFolding
 from .dead_code_elimination import DeadCodeElimination
+from .expression_fusion import ExpressionFusion
 from .forward_substitution import ForwardSubstitution
 from .gen_exp_to_imap import GenExpToImap
 from .iter_transformation import IterTransformation
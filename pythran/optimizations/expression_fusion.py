@@ -0,0 +1,249 @@
+"""
+ExpressionFusion merges chains of temporaries into a single expression.
+"""
+
+from pythran.analyses import Aliases, PureExpressions
+from pythran.openmp import OMPDirective
+from pythran.passmanager import Transformation
+import pythran.metadata as metadata
+
+import gast as ast
+import logging
+
+logger = logging.getLogger('pythran')
+
+
+class ExpressionFusion(Transformation):
+
+    """
+    Forward each definition of a temporary to its only use.
+
+    ForwardSubstitution works on names, so a name defined several times, as in
+    ``t = a * b; t = t + c``, is only forwarded once FalsePolymorphism has
+    split it, which never happens in functions using OpenMP. This pass works
+    on definitions instead: within a statement list, a pure value bound to a
+    name is moved into the next statement when it is the only one to read it
+    before the name is bound again, so that the whole chain ends up in one
+    expression and is evaluated in a single loop, without any intermediate
+    array.
+
+    >>> import gast as ast
+    >>> from pythran import passmanager, backend
+    >>> pm = passmanager.PassManager("test")
+    >>> node = ast.parse('''
+    ... def foo(a, b, c, out):
+    ...     t = a * b
+    ...     t = t + c
+    ...     out[:] = t
+    ...     t = a - b
+    ...     return t''')
+    >>> _, node = pm.apply(ExpressionFusion, node)
+    >>> print pm.dump(backend.Python, node)
+    def foo(a, b, c, out):
+        out[:] = ((a * b) + c)
+        return (a - b)
+    >>> node = ast.parse('''
+    ... def foo(a, b):
+    ...     t = a * b
+    ...     a = b
+    ...     return t''')
+    >>> _, node = pm.apply(ExpressionFusion, node)
+    >>> print pm.dump(backend.Python, node)
+    def foo(a, b):
+        t = (a * b)
+        a = b
+        return t
+    """
+
+    def __init__(self):
+        super(ExpressionFusion, self).__init__(Aliases, PureExpressions)
+
+    def visit_FunctionDef(self, node):
+        # names read from an exception handler may be read from any statement
+        # and names from OpenMP clauses must still be declared
+        self.function = node
+        self.pinned = set()
+        for n in ast.walk(node):
+            if isinstance(n, ast.Try):
+                for stmt in n.handlers + n.finalbody:
+                    self.pinned.update(m.id for m in ast.walk(stmt)
+                                       if isinstance(m, ast.Name))
+            for directive in metadata.get(n, OMPDirective):
+                self.pinned.update(dep.id for dep in directive.deps)
+        self.fuse(node.body, True)
+        for stmt in node.body:
+            self.visit(stmt)
+        return node
+
+    def visit_stmt(self, node):
+        for field in ('body', 'orelse', 'finalbody'):
+            stmts = getattr(node, field, None)
+            if stmts:
+                self.fuse(stmts, False)
+        for handler in getattr(node, 'handlers', ()):
+            self.fuse(handler.body, False)
+        return self.generic_visit(node)
+
+    visit_For = visit_While = visit_If = visit_Try = visit_stmt
+
+    def fuse(self, stmts, toplevel):
+        i = 0
+        while i < len(stmts):
+            consumer = self.fusable(stmts, i, toplevel)
+            if consumer is None:
+                i += 1
+                continue
+            stmt = stmts.pop(i)
+            name = stmt.targets[0].id
+            _Substitute(name, stmt.value).visit(stmts[consumer - 1])
+            logger.debug("Temporary `%s' from line %s fused into line %s",
+                         name, getattr(stmt, 'lineno', '?'),
+                         getattr(stmts[consumer - 1], 'lineno', '?'))
+            self.update = True
+
+    def fusable(self, stmts, i, toplevel):
+        """
+        Return the index of the statement reading the definition of
+        ``stmts[i]'', if it is the only one to do so, or None.
+        """
+        stmt = stmts[i]
+        if not isinstance(stmt, ast.Assign) or len(stmt.targets) != 1:
+            return None
+        if not isinstance(stmt.targets[0], ast.Name):
+            return None
+        if stmt.value not in self.pure_expressions:
+            return None
+        if metadata.get(stmt, OMPDirective):
+            return None
+        name = stmt.targets[0].id
+        if name in self.pinned:
+            return None
+        deps = [n for n in ast.walk(stmt.value) if isinstance(n, ast.Name)]
+        dep_ids = {n.id for n in deps}
+
+        # look for the reader, crossing only rebinding of unrelated names
+        j = i + 1
+        while j < len(stmts):
+            if metadata.get(stmts[j], OMPDirective):
+                return None
+            if _loads(stmts[j], name):
+                break
+            if not isinstance(stmts[j], ast.Assign):
+                return None
+            if stmts[j].value not in self.pure_expressions:
+                return None
+            for target in stmts[j].targets:
+                if not isinstance(target, ast.Name):
+                    return None
+                if target.id == name or target.id in dep_ids:
+                    return None
+            j += 1
+        else:
+            return None
+
+        reader = stmts[j]
+        if not isinstance(reader, (ast.Assign, ast.AugAssign, ast.Return,
+                                   ast.Expr)):
+            return None
+        if reader.value is None or reader.value not in self.pure_expressions:
+            return None
+        if _count_loads(reader, name) != 1:
+            return None
+        targets = getattr(reader, 'targets', [getattr(reader, 'target', None)])
+        for target in targets:
+            if target is None:
+                continue
+            if not self.writable(target, deps, isinstance(reader, ast.Assign)):
+                return None
+
+        # then make sure the value is not read once the reader is done
+        if isinstance(reader, ast.Return) or _rebinds(reader, name):
+            return j
+        for k in range(j + 1, len(stmts)):
+            if metadata.get(stmts[k], OMPDirective):
+                return None
+            if _rebinds(stmts[k], name) and not _loads(stmts[k], name):
+                return j
+            if not isinstance(stmts[k], (ast.Assign, ast.AugAssign,
+                                         ast.Expr, ast.Pass)):
+                return None
+            if any(isinstance(n, ast.Name) and n.id == name
+                   for n in ast.walk(stmts[k])):
+                return None
+        if toplevel:
+            return j
+        # a nested block must hold the whole lifetime of the name, starting
+        # with a binding so that nothing flows from the previous iteration
+        occurrences = [n for n in ast.walk(self.function)
+                       if isinstance(n, ast.Name) and n.id == name]
+        local_occurrences = [n for s in stmts for n in ast.walk(s)
+                             if isinstance(n, ast.Name) and n.id == name]
+        if len(occurrences) != len(local_occurrences):
+            return None
+        first = next(s for s in stmts if any(n in local_occurrences
+                                             for n in ast.walk(s)))
+        if _rebinds(first, name) and not _loads(first, name):
+            return j
+        return None
+
+    def writable(self, target, deps, rebind):
+        """
+        Check the reader may write ``target'' without changing the value of
+        the forwarded expression before it is computed.
+        """
+        if isinstance(target, ast.Name) and rebind:
+            return True
+        if isinstance(target, (ast.Tuple, ast.List)):
+            return all(self.writable(elt, deps, rebind) for elt in target.elts)
+        while isinstance(target, (ast.Subscript, ast.Attribute)):
+            target = target.value
+        if not isinstance(target, ast.Name):
+            return False
+        if any(dep.id == target.id for dep in deps):
+            return False
+        target_aliases = self.aliases.get(target, set())
+        return not any(target_aliases & self.aliases.get(dep, set())
+                       for dep in deps)
+
+
+class _Substitute(ast.NodeTransformer):
+
+    def __init__(self, name, value):
+        self.name = name
+        self.value = value
+
+    def visit_Name(self, node):
+        if node.id == self.name and isinstance(node.ctx, ast.Load):
+            return self.value
+        return node
+
+
+def _loads(stmt, name):
+    return _count_loads(stmt, name) != 0
+
+
+def _count_loads(stmt, name):
+    """
+    Number of reads of ``name'' in ``stmt'', or -1 if it is read from a scope
+    that may evaluate it several times.
+    """
+    count = 0
+    for node in ast.walk(stmt):
+        if isinstance(node, (ast.Lambda, ast.ListComp, ast.SetComp,
+                             ast.DictComp, ast.GeneratorExp)):
+            if any(isinstance(n, ast.Name) and n.id == name
+                   for n in ast.walk(node)):
+                return -1
+        elif isinstance(node, ast.AugAssign):
+            target = node.target
+            if isinstance(target, ast.Name) and target.id == name:
+                return -1
+        elif isinstance(node, ast.Name) and node.id == name:
+            count += isinstance(node.ctx, ast.Load)
+    return count
+
+
+def _rebinds(stmt, name):
+    return (isinstance(stmt, ast.Assign) and
+            any(isinstance(target, ast.Name) and target.id == name
+                for target in stmt.targets))
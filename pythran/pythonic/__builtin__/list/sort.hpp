@@ -7,6 +7,7 @@
 #include "pythonic/types/list.hpp"
 #include "pythonic/types/NoneType.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/timsort.hpp"
 
 namespace pythonic
 {
@@ -17,10 +18,118 @@ namespace pythonic
     namespace list
     {
 
+      namespace details
+      {
+        template <class A, class B>
+        bool default_less::operator()(A const &a, B const &b) const
+        {
+          return a < b;
+        }
+
+        template <class C>
+        template <class A, class B>
+        bool cmp_less<C>::operator()(A const &a, B const &b) const
+        {
+          return cmp(a, b) < 0;
+        }
+
+        default_less make_less(types::none_type const &)
+        {
+          return {};
+        }
+
+        template <class C>
+        cmp_less<C> make_less(C const &cmp)
+        {
+          return {cmp};
+        }
+
+        template <class T, class Less>
+        void sort(types::list<T> &seq, Less const &less,
+                  types::none_type const &, bool reverse)
+        {
+          // a stable sort on the flipped order keeps equal elements in
+          // order, as CPython does
+          if (reverse)
+            utils::timsort(seq.begin(), seq.end(),
+                           [&less](T const &a, T const &b) {
+                             return less(b, a);
+                           });
+          else
+            utils::timsort(seq.begin(), seq.end(), less);
+        }
+
+        template <class T, class C>
+        void sort(types::list<T> &seq, cmp_less<C> const &less,
+                  types::none_type const &, bool reverse)
+        {
+          std::vector<T> items(seq.begin(), seq.end());
+          if (reverse)
+            utils::timsort(items.begin(), items.end(),
+                           [&less](T const &a, T const &b) {
+                             return less(b, a);
+                           });
+          else
+            utils::timsort(items.begin(), items.end(), less);
+          std::move(items.begin(), items.end(), seq.begin());
+        }
+
+        template <class T, class Less, class K>
+        void sort(types::list<T> &seq, Less const &less, K const &key,
+                  bool reverse)
+        {
+          using key_type =
+              typename std::decay<decltype(key(std::declval<T &>()))>::type;
+          using decorated = std::pair<key_type, long>;
+          std::vector<decorated> items;
+          items.reserve(seq.size());
+          long index = 0;
+          for (auto &value : seq)
+            items.emplace_back(key(value), index++);
+          if (reverse)
+            utils::timsort(items.begin(), items.end(),
+                           [&less](decorated const &a, decorated const &b) {
+                             return less(b.first, a.first);
+                           });
+          else
+            utils::timsort(items.begin(), items.end(),
+                           [&less](decorated const &a, decorated const &b) {
+                             return less(a.first, b.first);
+                           });
+          std::vector<T> sorted;
+          sorted.reserve(items.size());
+          for (auto const &item : items)
+            sorted.push_back(std::move(seq.fast(item.second)));
+          std::move(sorted.begin(), sorted.end(), seq.begin());
+        }
+      }
+
       template <class T>
       types::none_type sort(types::list<T> &seq)
       {
-        std::sort(seq.begin(), seq.end());
+        details::sort(seq, details::default_less(), __builtin__::None, false);
+        return __builtin__::None;
+      }
+
+      template <class T, class C>
+      types::none_type sort(types::list<T> &seq, C const &cmp)
+      {
+        details::sort(seq, details::make_less(cmp), __builtin__::None, false);
+        return __builtin__::None;
+      }
+
+      template <class T, class C, class K>
+      types::none_type sort(types::list<T> &seq, C const &cmp, K const &key)
+      {
+        details::sort(seq, details::make_less(cmp), key, false);
+        return __builtin__::None;
+      }
+
+      template <class T, class C, class K>
+      types::none_type sort(types::list<T> &seq, C const &cmp, K const &key,
+                            bool reverse)
+      {
+        details::sort(seq, details::make_less(cmp), key, reverse);
         return __builtin__::None;
       }
 
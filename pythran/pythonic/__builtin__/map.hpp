@@ -9,7 +9,10 @@
 #include "pythonic/utils/fwd.hpp"
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/reserve.hpp"
+#include "pythonic/utils/tags.hpp"
 
+#include <exception>
+#include <iterator>
 #include <utility>
 
 namespace pythonic
@@ -33,6 +36,86 @@ namespace pythonic
         return s;
       }
 
+      template <typename Operator, typename Iterator, typename Out>
+      void map_fill(Operator &op, Iterator first, long n, Out out,
+                    purity::unknown_tag)
+      {
+        for (long i = 0; i < n; ++i, ++first)
+          out[i] = op(*first);
+      }
+
+      template <typename Operator, typename Iterator, typename Out>
+      void map_fill(Operator &op, Iterator first, long n, Out out,
+                    purity::pure_tag)
+      {
+#ifdef _OPENMP
+        if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+          // an exception may not leave the parallel region, the one from the
+          // first element is thrown afterward, as a sequential run would
+          std::exception_ptr error;
+          long error_index = n;
+#pragma omp parallel for
+          for (long i = 0; i < n; ++i) {
+            Iterator iter = first;
+            iter += i;
+            try {
+              out[i] = op(*iter);
+            } catch (...) {
+#pragma omp critical
+              if (i < error_index) {
+                error_index = i;
+                error = std::current_exception();
+              }
+            }
+          }
+          if (error)
+            std::rethrow_exception(error);
+        } else
+#endif
+          map_fill(op, first, n, out, purity::unknown_tag{});
+      }
+
+      template <typename Operator, typename List0>
+      auto map_seq(Operator &op, List0 &&seq, std::true_type)
+          -> types::list<decltype(op(*seq.begin()))>
+      {
+        auto first = seq.begin();
+        long n = seq.end() - first;
+        types::list<decltype(op(*seq.begin()))> s(n);
+        map_fill(op, first, n, s.begin(),
+                 typename purity_of<Operator>::type{});
+        return s;
+      }
+
+      template <typename Operator, typename List0>
+      auto map_seq(Operator &op, List0 &&seq, std::false_type)
+          -> types::list<decltype(op(*seq.begin()))>
+      {
+        types::list<decltype(op(*seq.begin()))> s(0);
+        utils::reserve(s, seq);
+        for (auto const &iseq : seq)
+          s.push_back(op(iseq));
+        return s;
+      }
+
+      template <typename Operator, typename List0>
+      auto map(Operator &op, List0 &&seq)
+          -> types::list<decltype(op(*seq.begin()))>
+      {
+        using value_type = decltype(op(*seq.begin()));
+        using category = typename std::iterator_traits<decltype(
+            seq.begin())>::iterator_category;
+        // booleans are packed, so they cannot be written concurrently
+        return map_seq(
+            op, std::forward<List0>(seq),
+            std::integral_constant<
+                bool, std::is_base_of<std::random_access_iterator_tag,
+                                      category>::value and
+                          ((std::is_arithmetic<value_type>::value and
+                            not std::is_same<value_type, bool>::value) or
+                           types::is_complex<value_type>::value)>{});
+      }
+
       template <typename List0, typename... Iterators>
       auto map(types::none_type, List0 &&seq, Iterators... iterators)
           -> types::list<decltype(types::make_tuple(*seq.begin(),
@@ -5,7 +5,9 @@
 
 #include "pythonic/__builtin__/StopIteration.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/yield.hpp"
 
+#include <type_traits>
 #include <utility>
 
 namespace pythonic
@@ -15,16 +17,28 @@ namespace pythonic
   {
 
     template <class T>
-    auto next(T &&y) -> decltype(*y)
+    auto next(T &&y) -> typename std::enable_if<
+        not std::is_base_of<yielder, typename std::decay<T>::type>::value,
+        typename std::decay<decltype(*y)>::type>::type
     {
       if ((decltype(y.begin()))y != y.end()) {
-        auto &&tmp = *y;
+        // a copy, as incrementing may update the value *y refers to
+        typename std::decay<decltype(*y)>::type tmp = *y;
         ++y;
         return tmp;
       } else
         throw types::StopIteration();
     }
 
+    template <class T>
+    typename std::enable_if<
+        std::is_base_of<yielder, typename std::decay<T>::type>::value,
+        typename std::decay<T>::type::result_type>::type
+    next(T &&y)
+    {
+      return y.next();
+    }
+
     DEFINE_FUNCTOR(pythonic::__builtin__, next);
   }
 }
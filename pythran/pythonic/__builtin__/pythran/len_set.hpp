@@ -4,8 +4,7 @@
 #include "pythonic/include/__builtin__/pythran/len_set.hpp"
 
 #include "pythonic/utils/functor.hpp"
-
-#include <set>
+#include "pythonic/utils/flat_hash_table.hpp"
 
 namespace pythonic
 {
@@ -19,7 +18,7 @@ namespace pythonic
       template <class Iterable>
       long len_set(Iterable const &s)
       {
-        return std::set<typename Iterable::iterator::value_type>(
+        return utils::flat_hash_set<typename Iterable::iterator::value_type>(
                    s.begin(), s.end()).size();
       }
 
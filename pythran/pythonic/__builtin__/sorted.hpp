@@ -3,11 +3,11 @@
 
 #include "pythonic/include/__builtin__/sorted.hpp"
 
+#include "pythonic/__builtin__/None.hpp"
+#include "pythonic/__builtin__/list/sort.hpp"
 #include "pythonic/types/list.hpp"
 #include "pythonic/utils/functor.hpp"
 
-#include <algorithm>
-
 namespace pythonic
 {
 
@@ -19,21 +19,34 @@ namespace pythonic
         typename std::remove_cv<typename Iterable::iterator::value_type>::type>
     sorted(Iterable const &seq)
     {
-      types::list<typename std::remove_cv<
-          typename Iterable::iterator::value_type>::type> out(seq.begin(),
-                                                              seq.end());
-      std::sort(out.begin(), out.end());
-      return out;
+      return sorted(seq, __builtin__::None, __builtin__::None, false);
     }
+
     template <class Iterable, class C>
     types::list<
         typename std::remove_cv<typename Iterable::iterator::value_type>::type>
     sorted(Iterable const &seq, C const &cmp)
+    {
+      return sorted(seq, cmp, __builtin__::None, false);
+    }
+
+    template <class Iterable, class C, class K>
+    types::list<
+        typename std::remove_cv<typename Iterable::iterator::value_type>::type>
+    sorted(Iterable const &seq, C const &cmp, K const &key)
+    {
+      return sorted(seq, cmp, key, false);
+    }
+
+    template <class Iterable, class C, class K>
+    types::list<
+        typename std::remove_cv<typename Iterable::iterator::value_type>::type>
+    sorted(Iterable const &seq, C const &cmp, K const &key, bool reverse)
     {
       types::list<typename std::remove_cv<
           typename Iterable::iterator::value_type>::type> out(seq.begin(),
                                                               seq.end());
-      std::sort(out.begin(), out.end(), cmp);
+      list::sort(out, cmp, key, reverse);
       return out;
     }
 
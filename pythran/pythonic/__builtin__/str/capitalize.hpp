@@ -20,10 +20,10 @@ namespace pythonic
         if (s.empty())
           return s;
         else {
-          types::str copy = s;
+          std::string copy(s.size(), 0);
           copy[0] = ::toupper(s[0]);
           std::transform(s.begin() + 1, s.end(), copy.begin() + 1, ::tolower);
-          return copy;
+          return {std::move(copy)};
         }
       }
 
@@ -61,28 +61,26 @@ namespace pythonic
         if (iterable_size == 0)
           return "";
         size_t n = ssize * (iterable_size - 1);
-        for (auto const &iter : iterable)
-          n += __builtin__::len(iter);
+        for (auto const &item : iterable)
+          n += __builtin__::len(item);
 
+        // items are copied by reference and the separator, most often a
+        // single character, is stored directly
         std::string out(n, 0);
-
+        char *oter = &out[0];
+        auto sep = std::begin(s);
         auto iter = iterable.begin();
-        auto oter = out.begin();
-        if (iter != iterable.end()) {
-          auto tmp = *iter;
-          oter = std::copy(tmp.begin(), tmp.end(), oter);
-          ++iter;
-          if (ssize)
-            for (; iter != iterable.end(); ++iter) {
-              oter = std::copy(std::begin(s), std::begin(s) + ssize, oter);
-              auto tmp = *iter;
-              oter = std::copy(tmp.begin(), tmp.end(), oter);
-            }
+        {
+          auto const &item = *iter;
+          oter = std::copy(std::begin(item), std::end(item), oter);
+        }
+        for (++iter; iter != iterable.end(); ++iter) {
+          if (ssize == 1)
+            *oter++ = *sep;
           else
-            for (; iter != iterable.end(); ++iter) {
-              auto tmp = *iter;
-              oter = std::copy(tmp.begin(), tmp.end(), oter);
-            }
+            oter = std::copy(sep, sep + ssize, oter);
+          auto const &item = *iter;
+          oter = std::copy(std::begin(item), std::end(item), oter);
         }
         return {std::move(out)};
       }
@@ -17,9 +17,9 @@ namespace pythonic
 
       types::str lower(types::str const &s)
       {
-        types::str copy = s;
+        std::string copy(s.size(), 0);
         std::transform(s.begin(), s.end(), copy.begin(), ::tolower);
-        return copy;
+        return {std::move(copy)};
       }
 
       DEFINE_FUNCTOR(pythonic::__builtin__::str, lower);
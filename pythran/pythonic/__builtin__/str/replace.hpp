@@ -6,6 +6,9 @@
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
 
+#include <algorithm>
+#include <string>
+
 namespace pythonic
 {
 
@@ -18,34 +21,42 @@ namespace pythonic
       types::str replace(types::str const &self, types::str const &old_pattern,
                          types::str const &new_pattern, long count)
       {
-        char const *needle = old_pattern.c_str();
-        char const *new_needle = new_pattern.c_str();
-        char const *new_needle_end = new_needle + new_pattern.size();
-        char const *haystack = self.c_str();
-
-        char const *haystack_next = strstr(haystack, needle);
-        if (not count or not haystack_next) {
-          return {haystack};
-        } else {
-          size_t n =
-              1 + std::max(self.size(), self.size() * (1 + new_pattern.size()) /
-                                            (1 + old_pattern.size()));
-          char *buffer = new char[n];
-          char *iter = buffer;
-          do {
-            iter = std::copy(haystack, haystack_next, iter);
-            iter = std::copy(new_needle, new_needle_end, iter);
-            --count;
-            haystack = haystack_next + old_pattern.size();
-            assert(size_t(iter - buffer) < n);
-          } while (count and (haystack_next = strstr(haystack, needle)));
-
-          std::copy(haystack, self.c_str() + self.size() + 1, iter);
-
-          types::str replaced(buffer);
-          delete[] buffer;
-          return replaced;
+        char const *haystack = self.chars();
+        size_t haystack_size = self.size();
+        size_t needle_size = old_pattern.size();
+        if (not count)
+          return self;
+
+        std::string out;
+        if (needle_size == 0) {
+          // the new pattern goes around each character
+          out.reserve(haystack_size * (1 + new_pattern.size()) +
+                      new_pattern.size());
+          size_t i = 0;
+          for (; i <= haystack_size and count; ++i, --count) {
+            out.append(new_pattern.chars(), new_pattern.size());
+            if (i < haystack_size)
+              out += haystack[i];
+          }
+          if (i < haystack_size)
+            out.append(haystack + i, haystack_size - i);
+          return {std::move(out)};
         }
+
+        // str::find scans for the first needle char with memchr, and unlike
+        // strstr this does not stop on embedded null characters
+        long next = self.find(old_pattern);
+        if (next < 0)
+          return self; // nothing to replace, share the buffer
+        out.reserve(haystack_size);
+        size_t current = 0;
+        do {
+          out.append(haystack + current, next - current);
+          out.append(new_pattern.chars(), new_pattern.size());
+          current = next + needle_size;
+        } while (--count and (next = self.find(old_pattern, current)) >= 0);
+        out.append(haystack + current, haystack_size - current);
+        return {std::move(out)};
       }
 
       DEFINE_FUNCTOR(pythonic::__builtin__::str, replace);
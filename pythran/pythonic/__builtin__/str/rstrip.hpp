@@ -17,7 +17,8 @@ namespace pythonic
 
       types::str rstrip(types::str const &self, types::str const &to_del)
       {
-        return {self.begin(), self.begin() + self.find_last_not_of(to_del) + 1};
+        auto last = self.find_last_not_of(to_del) + 1;
+        return self.substr(0, last);
       }
 
       DEFINE_FUNCTOR(pythonic::__builtin__::str, rstrip);
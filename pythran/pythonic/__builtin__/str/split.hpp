@@ -3,12 +3,16 @@
 
 #include "pythonic/include/__builtin__/str/split.hpp"
 
-#include "pythonic/__builtin__/str/strip.hpp"
+#include "pythonic/types/exceptions.hpp"
 #include "pythonic/types/list.hpp"
 #include "pythonic/types/NoneType.hpp"
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
 namespace pythonic
 {
 
@@ -21,28 +25,57 @@ namespace pythonic
       types::list<types::str> split(types::str const &in, types::str const &sep,
                                     long maxsplit)
       {
-        types::str s = strip(in);
+        if (sep.empty())
+          throw types::ValueError("empty separator");
+        char const *first = in.chars();
+        char const *last = first + in.size();
+        size_t needle_size = sep.size();
+
+        // tokens are views on the input buffer, so the separator lookup is
+        // the only pass over it
         types::list<types::str> res(0);
-        size_t current = 0;
-        size_t next = 0;
-        long numsplit = 0;
-        while (next != types::str::npos &&
-               (numsplit++ < maxsplit || maxsplit == -1)) {
-          next = s.find_first_of(sep, current);
-          res.push_back(s.substr(current, next - current));
-          current = next + 1;
+        if (needle_size == 1) {
+          long count = 1;
+          for (char const *iter = first;
+               (iter = (char const *)memchr(iter, sep[0], last - iter));
+               ++iter)
+            ++count;
+          res.reserve(maxsplit < 0 ? count : std::min(count, maxsplit + 1));
         }
-        if (next != types::str::npos) {
-          current = next + 1;
-          res.push_back(s.substr(current, s.size() - current));
+        long current = 0;
+        while (maxsplit-- != 0) {
+          long next = in.find(sep, current);
+          if (next < 0)
+            break;
+          res.push_back(in.substr(current, next - current));
+          current = next + needle_size;
         }
+        res.push_back(in.substr(current));
         return res;
       }
 
-      types::list<types::str> split(types::str const &s,
+      types::list<types::str> split(types::str const &in,
                                     types::none_type const &, long maxsplit)
       {
-        return split(s, " ", maxsplit);
+        char const *begin = in.chars();
+        char const *first = begin;
+        char const *last = first + in.size();
+        auto is_space = [](char c) { return std::isspace((unsigned char)c); };
+
+        types::list<types::str> res(0);
+        while (true) {
+          first = std::find_if_not(first, last, is_space);
+          if (first == last)
+            break;
+          if (maxsplit-- == 0) {
+            res.push_back(in.substr(first - begin));
+            break;
+          }
+          char const *next = std::find_if(first, last, is_space);
+          res.push_back(in.substr(first - begin, next - first));
+          first = next;
+        }
+        return res;
       }
 
       DEFINE_FUNCTOR(pythonic::__builtin__::str, split);
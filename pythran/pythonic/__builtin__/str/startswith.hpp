@@ -6,6 +6,9 @@
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace pythonic
 {
 
@@ -18,10 +21,21 @@ namespace pythonic
       bool startswith(types::str const &s, types::str const &prefix, long start,
                       long end)
       {
-        if (end < 0)
-          end = s.size();
-        return (end - start) >= prefix.size() and
-               s.compare(start, prefix.size(), prefix) == 0;
+        long size = s.size();
+        if (start < 0)
+          start = std::max(0L, start + size);
+        if (end < 0 or end > size)
+          end = size;
+        long prefix_size = prefix.size();
+        if (end - start < prefix_size)
+          return false;
+        // compare the buffers in place, the most common case being a one
+        // character prefix
+        char const *first = s.chars() + start;
+        char const *needle = prefix.chars();
+        if (prefix_size == 1)
+          return *first == *needle;
+        return std::memcmp(first, needle, prefix_size) == 0;
       }
 
       DEFINE_FUNCTOR(pythonic::__builtin__::str, startswith);
@@ -17,9 +17,9 @@ namespace pythonic
 
       types::str upper(types::str const &s)
       {
-        types::str copy = s;
+        std::string copy(s.size(), 0);
         std::transform(s.begin(), s.end(), copy.begin(), ::toupper);
-        return copy;
+        return {std::move(copy)};
       }
 
       DEFINE_FUNCTOR(pythonic::__builtin__::str, upper);
@@ -14,9 +14,57 @@ namespace pythonic
     namespace list
     {
 
+      namespace details
+      {
+        struct default_less {
+          template <class A, class B>
+          bool operator()(A const &a, B const &b) const;
+        };
+
+        // Python 2 ``cmp'' functions return a negative, null or positive int
+        template <class C>
+        struct cmp_less {
+          C cmp;
+          template <class A, class B>
+          bool operator()(A const &a, B const &b) const;
+        };
+
+        default_less make_less(types::none_type const &);
+        template <class C>
+        cmp_less<C> make_less(C const &cmp);
+
+        template <class T, class Less>
+        void sort(types::list<T> &seq, Less const &less,
+                  types::none_type const &key, bool reverse);
+
+        /* ``cmp'' may raise: a copy is sorted, then moved back */
+        template <class T, class C>
+        void sort(types::list<T> &seq, cmp_less<C> const &less,
+                  types::none_type const &key, bool reverse);
+
+        /* Decorate-sort-undecorate: each key is computed once, then sorted
+         * along with the index of its element. Elements are only moved once
+         * sorted, so an exception from ``key'' or ``cmp'' leaves the list
+         * unchanged.
+         */
+        template <class T, class Less, class K>
+        void sort(types::list<T> &seq, Less const &less, K const &key,
+                  bool reverse);
+      }
+
       template <class T>
       types::none_type sort(types::list<T> &seq);
 
+      template <class T, class C>
+      types::none_type sort(types::list<T> &seq, C const &cmp);
+
+      template <class T, class C, class K>
+      types::none_type sort(types::list<T> &seq, C const &cmp, K const &key);
+
+      template <class T, class C, class K>
+      types::none_type sort(types::list<T> &seq, C const &cmp, K const &key,
+                            bool reverse);
+
       DECLARE_FUNCTOR(pythonic::__builtin__::list, sort);
     }
   }
@@ -5,6 +5,7 @@
 #include "pythonic/include/types/list.hpp"
 #include "pythonic/include/types/NoneType.hpp"
 #include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/utils/broadcast_copy.hpp"
 
 #include <utility>
 
@@ -20,6 +21,15 @@ namespace pythonic
       auto map(Operator &op, List0 &&seq, Iterators... iterators)
           -> types::list<decltype(op(*seq.begin(), *iterators...))>;
 
+      /* Mapping over a single random access sequence to scalars, the
+       * typical list comprehension, fills preallocated storage by index, in a
+       * loop the compiler can vectorize and that runs in parallel when the
+       * operator is pure.
+       */
+      template <typename Operator, typename List0>
+      auto map(Operator &op, List0 &&seq)
+          -> types::list<decltype(op(*seq.begin()))>;
+
       template <typename List0, typename... Iterators>
       auto map(types::none_type, List0 &&seq, Iterators... iterators)
           -> types::list<decltype(types::make_tuple(*seq.begin(),
@@ -2,7 +2,9 @@
 #define PYTHONIC_INCLUDE_BUILTIN_NEXT_HPP
 
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/yield.hpp"
 
+#include <type_traits>
 #include <utility>
 
 namespace pythonic
@@ -12,7 +14,16 @@ namespace pythonic
   {
 
     template <class T>
-    auto next(T &&y) -> decltype(*y);
+    auto next(T &&y) -> typename std::enable_if<
+        not std::is_base_of<yielder, typename std::decay<T>::type>::value,
+        typename std::decay<decltype(*y)>::type>::type;
+
+    // generators produce their next value themselves
+    template <class T>
+    typename std::enable_if<
+        std::is_base_of<yielder, typename std::decay<T>::type>::value,
+        typename std::decay<T>::type::result_type>::type
+    next(T &&y);
 
     DECLARE_FUNCTOR(pythonic::__builtin__, next);
   }
@@ -2,6 +2,7 @@
 #define PYTHONIC_INCLUDE_BUILTIN_PYTHRAN_LEN_SET_HPP
 
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/flat_hash_table.hpp"
 
 namespace pythonic
 {
@@ -20,6 +20,16 @@ namespace pythonic
         typename std::remove_cv<typename Iterable::iterator::value_type>::type>
     sorted(Iterable const &seq, C const &cmp);
 
+    template <class Iterable, class C, class K>
+    types::list<
+        typename std::remove_cv<typename Iterable::iterator::value_type>::type>
+    sorted(Iterable const &seq, C const &cmp, K const &key);
+
+    template <class Iterable, class C, class K>
+    types::list<
+        typename std::remove_cv<typename Iterable::iterator::value_type>::type>
+    sorted(Iterable const &seq, C const &cmp, K const &key, bool reverse);
+
     DECLARE_FUNCTOR(pythonic::__builtin__, sorted);
   }
 }
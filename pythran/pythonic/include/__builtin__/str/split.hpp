@@ -16,11 +16,11 @@ namespace pythonic
     {
 
       types::list<types::str> split(types::str const &in,
-                                    types::str const &sep = " \n",
-                                    long maxsplit = -1);
+                                    types::str const &sep, long maxsplit = -1);
 
       types::list<types::str>
-      split(types::str const &s, types::none_type const &, long maxsplit = -1);
+      split(types::str const &in,
+            types::none_type const & = types::none_type(), long maxsplit = -1);
 
       DECLARE_FUNCTOR(pythonic::__builtin__::str, split);
     }
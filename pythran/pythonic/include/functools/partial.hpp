@@ -1,6 +1,7 @@
 #ifndef PYTHONIC_INCLUDE_FUNCTOOLS_PARTIAL_HPP
 #define PYTHONIC_INCLUDE_FUNCTOOLS_PARTIAL_HPP
 
+#include "pythonic/include/types/traits.hpp"
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/utils/seq.hpp"
 
@@ -16,9 +17,23 @@ namespace pythonic
     namespace details
     {
 
+      /* binding arguments to a pure function gives a pure function */
+      template <bool is_pure>
+      struct task_purity {
+      };
+
+      template <>
+      struct task_purity<true> {
+        using pure = void;
+      };
+
+      template <typename... ClosureTypes>
+      using task_purity_of = task_purity<types::is_pure<typename std::
+          tuple_element<0, std::tuple<ClosureTypes...>>::type>::value>;
+
       /* a task that captures its environnment for later call */
       template <typename... ClosureTypes>
-      struct task {
+      struct task : task_purity_of<ClosureTypes...> {
 
         mutable std::tuple<ClosureTypes...> closure; // closure associated to
                                                      // the task, mutable
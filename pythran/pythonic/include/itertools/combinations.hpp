@@ -1,8 +1,10 @@
 #ifndef PYTHONIC_INCLUDE_ITERTOOLS_COMBINATIONS_HPP
 #define PYTHONIC_INCLUDE_ITERTOOLS_COMBINATIONS_HPP
 
+#include "pythonic/include/itertools/common.hpp"
 #include "pythonic/include/types/list.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
 
 #include <vector>
 #include <iterator>
@@ -14,30 +16,46 @@ namespace pythonic
   {
     namespace details
     {
+      /* Combinations are yielded in lexicographic order of their indices in
+       * the pool, as a reference to a list the iterator updates in place.
+       * A new list is only allocated when the previous one is still
+       * referenced elsewhere, i.e. when the value escapes the loop body.
+       *
+       * The iterator is random access, combinations being ranked in the
+       * combinatorial number system, so that OpenMP can split the loop.
+       */
       template <class T>
       struct combination_iterator
-          : std::iterator<std::forward_iterator_tag,
-                          types::list<typename T::value_type>, ptrdiff_t,
+          : std::iterator<std::random_access_iterator_tag,
+                          types::list<typename T::value_type>, long,
                           types::list<typename T::value_type> *,
-                          types::list<typename T::value_type> /*no ref*/
-                          > {
-        std::vector<typename T::value_type> pool;
+                          types::list<typename T::value_type> &> {
+        utils::shared_ref<std::vector<typename T::value_type>> pool;
         std::vector<long> indices;
         long r;
-        bool stopped;
+        long position; // rank of the current combination
         types::list<typename T::value_type> result;
 
         combination_iterator() = default;
-        combination_iterator(bool);
+        combination_iterator(
+            utils::shared_ref<std::vector<typename T::value_type>> const &pool,
+            long r, long position);
 
-        template <class Iter>
-        combination_iterator(Iter &&pool, long r);
-
-        types::list<typename T::value_type> operator*() const;
+        types::list<typename T::value_type> &operator*();
         combination_iterator &operator++();
+        combination_iterator &operator--();
+        combination_iterator &operator+=(long n);
+        combination_iterator &operator-=(long n);
+        combination_iterator operator+(long n) const;
+        combination_iterator operator-(long n) const;
+        long operator-(combination_iterator const &other) const;
         bool operator!=(combination_iterator const &other) const;
         bool operator==(combination_iterator const &other) const;
         bool operator<(combination_iterator const &other) const;
+
+      private:
+        void unrank();
+        void update_result();
       };
 
       template <class T>
@@ -46,6 +64,7 @@ namespace pythonic
         using value_type = T;
 
         long num_elts;
+        iterator end_iter;
 
         combination() = default;
 
@@ -53,7 +72,7 @@ namespace pythonic
         combination(Iter &&iter, long elts);
         iterator const &begin() const;
         iterator begin();
-        iterator end() const;
+        iterator const &end() const;
       };
     }
 
@@ -9,6 +9,15 @@ namespace pythonic
 
     struct npos {
     };
+
+    namespace details
+    {
+      // number of k-combinations of n elements, saturated to LONG_MAX
+      long binomial(long n, long k);
+
+      // number of k-permutations of n elements, saturated to LONG_MAX
+      long arrangements(long n, long k);
+    }
   }
 }
 
@@ -1,9 +1,10 @@
 #ifndef PYTHONIC_INCLUDE_ITERTOOLS_PERMUTATIONS_HPP
 #define PYTHONIC_INCLUDE_ITERTOOLS_PERMUTATIONS_HPP
 
+#include "pythonic/include/itertools/common.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
 #include "pythonic/include/types/list.hpp"
-#include "pythonic/include/__builtin__/range.hpp"
 
 #include <iterator>
 #include <vector>
@@ -28,42 +29,57 @@ namespace pythonic
      *
      *  [(0, 1, 2), (0, 2, 1), (1, 0, 2), (1, 2, 0), (2, 0, 1), (2, 1, 0)]
      *
+     *  As for combinations, the yielded list is updated in place unless it
+     *  escaped, and permutations are ranked, in the factorial number
+     *  system, to provide random access.
      */
     template <class T>
     struct permutations_iterator
-        : std::iterator<std::forward_iterator_tag,
-                        types::list<typename T::value_type>, ptrdiff_t,
+        : std::iterator<std::random_access_iterator_tag,
+                        types::list<typename T::value_type>, long,
                         types::list<typename T::value_type> *,
-                        types::list<typename T::value_type> /* no ref*/
-                        > {
+                        types::list<typename T::value_type> &> {
       // Vector of inputs, contains elements to permute
-      std::vector<typename T::value_type> pool;
+      utils::shared_ref<std::vector<typename T::value_type>> pool;
 
       // The current permutation as a list of index in the pool
-      // Internally it always has the same size as the pool, even if the
-      // external view is limited
-      types::list<int> curr_permut;
+      // Internally it always has the same size as the pool, the indices
+      // past the "visible" permutation being sorted
+      std::vector<long> curr_permut;
 
       // Size of the "visible" permutation
-      size_t _size;
-      bool end; // sentinel marker
+      long _size;
+      long position; // rank of the current permutation
+      types::list<typename T::value_type> result;
 
       permutations_iterator();
-      permutations_iterator(std::vector<typename T::value_type> const &iter,
-                            size_t num_elts, bool end);
+      permutations_iterator(
+          utils::shared_ref<std::vector<typename T::value_type>> const &pool,
+          long num_elts, long position);
 
-      /** Build the permutation visible from the "outside" */
-      types::list<typename T::value_type> operator*() const;
+      /** The permutation visible from the "outside" */
+      types::list<typename T::value_type> &operator*();
 
       /*  Generate next permutation
        *
-       *  If the size of the permutation is smaller than the size of the
-       *  pool, we may have to iterate multiple times
+       *  Reversing the indices past the visible ones makes them the last
+       *  permutation of that suffix, so that std::next_permutation changes
+       *  the visible prefix.
        */
       permutations_iterator &operator++();
+      permutations_iterator &operator--();
+      permutations_iterator &operator+=(long n);
+      permutations_iterator &operator-=(long n);
+      permutations_iterator operator+(long n) const;
+      permutations_iterator operator-(long n) const;
+      long operator-(permutations_iterator const &other) const;
       bool operator!=(permutations_iterator const &other) const;
       bool operator==(permutations_iterator const &other) const;
       bool operator<(permutations_iterator const &other) const;
+
+    private:
+      void unrank();
+      void update_result();
     };
 
     template <class T>
@@ -72,12 +88,14 @@ namespace pythonic
       using value_type = T;
       using iterator = permutations_iterator<T>;
 
+      iterator end_iter;
+
       _permutations();
       _permutations(T iter, int elts);
 
       iterator const &begin() const;
       iterator begin();
-      iterator end() const;
+      iterator const &end() const;
     };
 
     template <typename T0>
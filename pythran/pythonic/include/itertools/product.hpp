@@ -4,6 +4,8 @@
 #include "pythonic/include/utils/iterator.hpp"
 #include "pythonic/include/itertools/common.hpp"
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/int_.hpp"
+#include "pythonic/include/utils/seq.hpp"
 
 #include <iterator>
 #include <type_traits>
@@ -16,16 +18,21 @@ namespace pythonic
     namespace details
     {
 
-      // FIXME : should be a combined_iterator_tag
+      /* Random access if all the iterators are, the position being
+       * decomposed in the mixed radix of the iterables' lengths, so that
+       * OpenMP can split the loop.
+       */
       template <typename... Iters>
       struct product_iterator
-          : std::iterator<std::forward_iterator_tag,
-                          std::tuple<typename Iters::value_type...>> {
+          : std::iterator<
+                typename utils::iterator_min<typename Iters::iterator...>::type,
+                std::tuple<typename Iters::value_type...>> {
 
-        std::tuple<typename Iters::iterator...> const it_begin;
-        std::tuple<typename Iters::iterator...> const it_end;
+        std::tuple<typename Iters::iterator...> it_begin;
+        std::tuple<typename Iters::iterator...> it_end;
         std::tuple<typename Iters::iterator...> it;
         bool end;
+        long position; // number of increments from the first tuple
 
         product_iterator() = default;
         template <int... I>
@@ -36,6 +43,9 @@ namespace pythonic
                          utils::seq<I...> const &);
         std::tuple<typename Iters::value_type...> operator*() const;
         product_iterator &operator++();
+        product_iterator &operator+=(long n);
+        product_iterator operator+(long n) const;
+        long operator-(product_iterator const &other) const;
         bool operator==(product_iterator const &other) const;
         bool operator!=(product_iterator const &other) const;
         bool operator<(product_iterator const &other) const;
@@ -47,6 +57,11 @@ namespace pythonic
         template <int... I>
         std::tuple<typename Iters::value_type...>
         get_value(utils::seq<I...> const &) const;
+        template <int... I>
+        long size(utils::seq<I...> const &) const;
+        template <size_t N>
+        void seek(long rank, utils::int_<N>);
+        void seek(long rank, utils::int_<0>);
       };
 
       template <typename... Iters>
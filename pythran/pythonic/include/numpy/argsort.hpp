@@ -3,6 +3,7 @@
 
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/sort.hpp"
 
 namespace pythonic
 {
@@ -10,7 +11,8 @@ namespace pythonic
   namespace numpy
   {
     template <class T, size_t N>
-    types::ndarray<long, N> argsort(types::ndarray<T, N> const &a);
+    types::ndarray<long, N> argsort(types::ndarray<T, N> const &a,
+                                    long axis = -1);
 
     NUMPY_EXPR_TO_NDARRAY0_DECL(argsort);
 
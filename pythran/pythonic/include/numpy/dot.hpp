@@ -5,6 +5,7 @@
 #include "pythonic/include/numpy/sum.hpp"
 #include "pythonic/include/types/numpy_expr.hpp"
 #include "pythonic/include/types/traits.hpp"
+#include "pythonic/include/utils/blocked_gemm.hpp"
 
 template <class T>
 struct is_blas_type : pythonic::types::is_complex<T> {
@@ -37,73 +38,97 @@ namespace pythonic
         typename __combined<typename E::dtype, typename F::dtype>::type>::type
     dot(E const &e, F const &f);
 
-    /// Matrice / Vector multiplication
+    namespace details
+    {
+      /* First element and strides of an operand, in elements. Arrays and
+       * their transposition, their slices and their rows are read in place,
+       * other expressions are evaluated first.
+       */
+      template <class E, class Enable = void>
+      struct strided_operand {
+        using dtype = typename E::dtype;
+        types::ndarray<dtype, E::value> values;
+        dtype const *data;
+        types::array<long, E::value> strides;
+        strided_operand(E const &expr);
+      };
+
+      template <class T, size_t N>
+      struct strided_operand<types::ndarray<T, N>> {
+        T const *data;
+        types::array<long, N> strides;
+        strided_operand(types::ndarray<T, N> const &expr);
+      };
+
+      template <class T>
+      struct strided_operand<types::numpy_texpr<types::ndarray<T, 2>>> {
+        T const *data;
+        types::array<long, 2> strides;
+        strided_operand(types::numpy_texpr<types::ndarray<T, 2>> const &expr);
+      };
+
+      template <class Arg>
+      struct strided_operand<
+          types::numpy_iexpr<Arg>,
+          typename std::enable_if<types::is_ndarray<
+              typename std::decay<Arg>::type>::value>::type> {
+        using dtype = typename types::numpy_iexpr<Arg>::dtype;
+        dtype const *data;
+        types::array<long, types::numpy_iexpr<Arg>::value> strides;
+        strided_operand(types::numpy_iexpr<Arg> const &expr);
+      };
+
+      template <class Arg, class... S>
+      struct strided_operand<
+          types::numpy_gexpr<Arg, S...>,
+          typename std::enable_if<
+              types::is_ndarray<typename std::decay<Arg>::type>::value and
+              types::count_long<S...>::value == 0>::type> {
+        using dtype = typename types::numpy_gexpr<Arg, S...>::dtype;
+        dtype const *data;
+        types::array<long, types::numpy_gexpr<Arg, S...>::value> strides;
+        strided_operand(types::numpy_gexpr<Arg, S...> const &expr);
+      };
+
+      // c = a.b, the rows of ``c'' being ``c_stride'' elements apart
+      template <class A, class B, class C>
+      void matrix_product(long m, long n, long k, A const *a, long a_rs,
+                          long a_cs, B const *b, long b_rs, long b_cs, C *c,
+                          long c_stride);
+
+      // y = a.x
+      template <class A, class X, class Y>
+      void matrix_vector(long m, long n, A const *a, long a_rs, long a_cs,
+                         X const *x, long x_stride, Y *y);
+
+      /* c[..., :, :] = a[..., :, :].b[..., :, :] for the C-contiguous ``c''
+       * of shape ``shape'', the strides of the operands being 0 along the
+       * axes they are broadcast on
+       */
+      template <class A, class B, class C, size_t N>
+      void batched_product(types::array<long, N> const &shape, long k,
+                           A const *a, types::array<long, N> const &a_strides,
+                           B const *b, types::array<long, N> const &b_strides,
+                           C *c);
+    }
+
+    /// Matrix / Vector multiplication
 
-    // We transpose the matrix to reflect our C order
-    template <class E>
-    typename std::enable_if<is_blas_type<E>::value, types::ndarray<E, 1>>::type
-        dot(types::ndarray<E, 2> const &f, types::ndarray<E, 1> const &e);
-
-    // The trick is to not transpose the matrix so that MV become VM
-    template <class E>
-    typename std::enable_if<is_blas_type<E>::value, types::ndarray<E, 1>>::type
-        dot(types::ndarray<E, 1> const &e, types::ndarray<E, 2> const &f);
-
-    // If arguments could be use with blas, we evaluate them as we need pointer
-    // on array for blas
     template <class E, class F>
     typename std::enable_if<
         types::is_numexpr_arg<E>::value and
-            types::is_numexpr_arg<F>::value // It is an array_like
-            and
-            not(types::is_ndarray<E>::value and types::is_ndarray<F>::value) and
-            is_blas_type<typename E::dtype>::value and
-            is_blas_type<typename F::dtype>::value // With dtype compatible with
-                                                   // blas
-            and
-            E::value == 2 and F::value == 1, // And it is matrix / vect
+            types::is_numexpr_arg<F>::value and E::value == 2 and
+            F::value == 1, // And it is matrix / vect
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
             1>>::type
     dot(E const &e, F const &f);
 
-    // If arguments could be use with blas, we evaluate them as we need pointer
-    // on array for blas
     template <class E, class F>
     typename std::enable_if<
         types::is_numexpr_arg<E>::value and
-            types::is_numexpr_arg<F>::value // It is an array_like
-            and
-            not(types::is_ndarray<E>::value and types::is_ndarray<F>::value) and
-            is_blas_type<typename E::dtype>::value and
-            is_blas_type<typename F::dtype>::value // With dtype compatible with
-                                                   // blas
-            and
-            E::value == 1 and F::value == 2, // And it is vect / matrix
-        types::ndarray<
-            typename __combined<typename E::dtype, typename F::dtype>::type,
-            1>>::type
-    dot(E const &e, F const &f);
-
-    // If one of the arg doesn't have a "blas compatible type", we use a slow
-    // matrix vector multiplication.
-    template <class E, class F>
-    typename std::enable_if<
-        (not is_blas_type<typename E::dtype>::value or
-         not is_blas_type<typename F::dtype>::value) and
-            E::value == 1 and F::value == 2, // And it is vect / matrix
-        types::ndarray<
-            typename __combined<typename E::dtype, typename F::dtype>::type,
-            1>>::type
-    dot(E const &e, F const &f);
-
-    // If one of the arg doesn't have a "blas compatible type", we use a slow
-    // matrix vector multiplication.
-    template <class E, class F>
-    typename std::enable_if<
-        (not is_blas_type<typename E::dtype>::value or
-         not is_blas_type<typename F::dtype>::value) and
-            E::value == 2 and F::value == 1, // And it is vect / matrix
+            types::is_numexpr_arg<F>::value and E::value == 1 and
+            F::value == 2, // And it is vect / matrix
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
             1>>::type
@@ -111,42 +136,29 @@ namespace pythonic
 
     /// Matrix / Matrix multiplication
 
-    // The trick is to use the transpose arguments to reflect C order.
-    // We want to perform A * B in C order but blas order is F order.
-    // So we compute B'A' == (AB)'. As this equality is perform with F order
-    // We doesn't have to return a texpr because we want a C order matrice!!
-    template <class E>
-    typename std::enable_if<is_blas_type<E>::value, types::ndarray<E, 2>>::type
-        dot(types::ndarray<E, 2> const &a, types::ndarray<E, 2> const &b);
-
-    // If arguments could be sue with blas, we evaluate them as we need pointer
-    // on array for blas
+    // BLAS is used for its dtypes when it can read the operands in place,
+    // a blocked product otherwise.
     template <class E, class F>
     typename std::enable_if<
         types::is_numexpr_arg<E>::value and
-            types::is_numexpr_arg<F>::value // It is an array_like
-            and
-            not(types::is_ndarray<E>::value and types::is_ndarray<F>::value) and
-            is_blas_type<typename E::dtype>::value and
-            is_blas_type<typename F::dtype>::value // With dtype compatible with
-                                                   // blas
-            and
-            E::value == 2 and F::value == 2, // And both are matrix
+            types::is_numexpr_arg<F>::value and E::value == 2 and
+            F::value == 2, // And both are matrix
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
             2>>::type
     dot(E const &e, F const &f);
 
-    // If one of the arg doesn't have a "blas compatible type", we use a slow
-    // matrix multiplication.
+    /// Array / Matrix and Array / Vector multiplication, over the last axis
+    /// of the array
+
     template <class E, class F>
     typename std::enable_if<
-        (not is_blas_type<typename E::dtype>::value or
-         not is_blas_type<typename F::dtype>::value) and
-            E::value == 2 and F::value == 2, // And it is matrix / matrix
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and (E::value > 2) and
+            (F::value == 1 or F::value == 2),
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
-            2>>::type
+            E::value + F::value - 2>>::type
     dot(E const &e, F const &f);
 
     DECLARE_FUNCTOR(pythonic::numpy, dot);
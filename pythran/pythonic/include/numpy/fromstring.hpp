@@ -3,11 +3,9 @@
 
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/numpy/float64.hpp"
+#include "pythonic/include/utils/text_parser.hpp"
 #include "pythonic/include/types/ndarray.hpp"
-#include "pythonic/include/types/list.hpp"
-
-#include <limits>
-#include <sstream>
+#include "pythonic/include/types/str.hpp"
 
 namespace pythonic
 {
@@ -0,0 +1,40 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_LOADTXT_HPP
+#define PYTHONIC_INCLUDE_NUMPY_LOADTXT_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/text_parser.hpp"
+#include "pythonic/include/numpy/float64.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/types/str.hpp"
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      // a single column selected as an integer gives a 1D array
+      template <class U>
+      struct loadtxt_dim : std::integral_constant<size_t, 2> {
+      };
+
+      template <>
+      struct loadtxt_dim<long> : std::integral_constant<size_t, 1> {
+      };
+    }
+
+    template <class dtype = functor::float64, class C = types::str,
+              class D = types::none_type, class U = types::none_type>
+    types::ndarray<typename dtype::type, details::loadtxt_dim<U>::value>
+    loadtxt(types::str const &fname, dtype d = dtype(),
+            C const &comments = "#", D const &delimiter = D(),
+            types::none_type const &converters = types::none_type(),
+            long skiprows = 0, U const &usecols = U());
+
+    DECLARE_FUNCTOR(pythonic::numpy, loadtxt);
+  }
+}
+
+#endif
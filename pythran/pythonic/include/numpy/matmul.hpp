@@ -0,0 +1,49 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_MATMUL_HPP
+#define PYTHONIC_INCLUDE_NUMPY_MATMUL_HPP
+
+#include "pythonic/include/numpy/dot.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/utils/functor.hpp"
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      template <class E, class F>
+      struct matmul_dim {
+        static constexpr size_t batched =
+            E::value > F::value ? E::value : F::value;
+        // vectors lose their matrix axis in the result
+        static constexpr size_t value =
+            batched - (E::value == 1) - (F::value == 1);
+      };
+    }
+
+    // Matrices and vectors, as numpy.dot
+    template <class E, class F>
+    typename std::enable_if<
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and E::value <= 2 and
+            F::value <= 2,
+        decltype(dot(std::declval<E>(), std::declval<F>()))>::type
+    matmul(E const &e, F const &f);
+
+    // Stacks of matrices, broadcast along the leading axes
+    template <class E, class F>
+    typename std::enable_if<
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and
+            (E::value > 2 or F::value > 2),
+        types::ndarray<
+            typename __combined<typename E::dtype, typename F::dtype>::type,
+            details::matmul_dim<E, F>::value>>::type
+    matmul(E const &e, F const &f);
+
+    DECLARE_FUNCTOR(pythonic::numpy, matmul);
+  }
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 #include "pythonic/include/numpy/asarray.hpp"
+#include "pythonic/include/numpy/percentile.hpp"
 #include <algorithm>
 
 namespace pythonic
@@ -12,10 +13,19 @@ namespace pythonic
   namespace numpy
   {
     template <class T, size_t N>
-    decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> const &arr);
+    decltype(std::declval<T>() + 1.)
+        median(types::ndarray<T, N> const &arr,
+               types::none_type axis = __builtin__::None);
 
     template <class T, size_t N>
-    decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> &&arr);
+    decltype(std::declval<T>() + 1.)
+        median(types::ndarray<T, N> &&arr,
+               types::none_type axis = __builtin__::None);
+
+    template <class T, size_t N>
+    typename details::lane_reduce_result<decltype(std::declval<T>() + 1.),
+                                         N>::type
+    median(types::ndarray<T, N> const &arr, long axis);
 
     NUMPY_EXPR_TO_NDARRAY0_DECL(median);
 
@@ -0,0 +1,98 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_PERCENTILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_PERCENTILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/sort.hpp"
+#include "pythonic/include/__builtin__/None.hpp"
+
+#include <vector>
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      template <class T>
+      using quantile_type = decltype(std::declval<T>() + 1.);
+
+      /* Result of a reduction of an ``N'' dimensional array along an axis */
+      template <class T, size_t N>
+      struct lane_reduce_result {
+        using type = types::ndarray<T, N - 1>;
+      };
+      template <class T>
+      struct lane_reduce_result<T, 1> {
+        using type = T;
+      };
+
+      /* Selection engine shared by median, percentile and quantile. Each
+       * function reorders the values of [first, last) and runs in linear
+       * time.
+       */
+
+      // median of [first, last)
+      template <class T>
+      quantile_type<T> lane_median(T *first, T *last);
+
+      /* ``qs[order[i]]''-th quantile of [first, last) for ``i'' in [0, n),
+       * ``qs'' being in [0, 1] and ``order'' sorting it. Results are stored
+       * in ``out[order[i]]''.
+       */
+      template <class T>
+      void lane_quantiles(T *first, T *last, double const *qs,
+                          long const *order, long n, quantile_type<T> *out);
+
+      // ``q''-th quantile of [first, last)
+      template <class T>
+      quantile_type<T> lane_quantile(T *first, T *last, double q);
+
+      /* Reduce every lane of ``arr'' along ``axis'' to ``f(first, last)''.
+       * Lanes are reduced in parallel, and the content of ``arr'' is
+       * reordered.
+       */
+      template <class R, class T, size_t N, class F>
+      typename lane_reduce_result<R, N>::type
+      reduce_lanes(types::ndarray<T, N> &arr, long axis, F const &f);
+
+      // ``q'' is a fraction in [0, 1]
+      template <class T, size_t N>
+      quantile_type<T> quantile(types::ndarray<T, N> const &a, double q,
+                                types::none_type axis);
+
+      template <class T, size_t N>
+      typename lane_reduce_result<quantile_type<T>, N>::type
+      quantile(types::ndarray<T, N> const &a, double q, long axis);
+
+      template <class T, size_t N>
+      types::ndarray<quantile_type<T>, 1>
+      quantile(types::ndarray<T, N> const &a, std::vector<double> const &qs,
+               types::none_type axis);
+
+      // convert a percentile to a fraction, checking its range
+      double percentile_fraction(double q);
+    }
+
+    template <class T, size_t N>
+    details::quantile_type<T>
+    percentile(types::ndarray<T, N> const &a, double q,
+               types::none_type axis = __builtin__::None);
+
+    template <class T, size_t N>
+    typename details::lane_reduce_result<details::quantile_type<T>, N>::type
+    percentile(types::ndarray<T, N> const &a, double q, long axis);
+
+    template <class T, size_t N, class Q>
+    typename std::enable_if<not std::is_arithmetic<Q>::value,
+                            types::ndarray<details::quantile_type<T>, 1>>::type
+    percentile(types::ndarray<T, N> const &a, Q const &qs,
+               types::none_type axis = __builtin__::None);
+
+    NUMPY_EXPR_TO_NDARRAY0_DECL(percentile);
+    DECLARE_FUNCTOR(pythonic::numpy, percentile);
+  }
+}
+
+#endif
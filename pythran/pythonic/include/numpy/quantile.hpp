@@ -0,0 +1,39 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_QUANTILE_HPP
+#define PYTHONIC_INCLUDE_NUMPY_QUANTILE_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/ndarray.hpp"
+#include "pythonic/include/numpy/percentile.hpp"
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      // check the range of a quantile
+      double quantile_fraction(double q);
+    }
+
+    template <class T, size_t N>
+    details::quantile_type<T>
+    quantile(types::ndarray<T, N> const &a, double q,
+             types::none_type axis = __builtin__::None);
+
+    template <class T, size_t N>
+    typename details::lane_reduce_result<details::quantile_type<T>, N>::type
+    quantile(types::ndarray<T, N> const &a, double q, long axis);
+
+    template <class T, size_t N, class Q>
+    typename std::enable_if<not std::is_arithmetic<Q>::value,
+                            types::ndarray<details::quantile_type<T>, 1>>::type
+    quantile(types::ndarray<T, N> const &a, Q const &qs,
+             types::none_type axis = __builtin__::None);
+
+    NUMPY_EXPR_TO_NDARRAY0_DECL(quantile);
+    DECLARE_FUNCTOR(pythonic::numpy, quantile);
+  }
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef PYTHONIC_INCLUDE_NUMPY_RANDOM_GENERATOR_HPP
 #define PYTHONIC_INCLUDE_NUMPY_RANDOM_GENERATOR_HPP
 
+#include "pythonic/include/utils/philox.hpp"
+
 #include <random>
 
 namespace pythonic
@@ -11,12 +13,20 @@ namespace pythonic
     {
       namespace details
       {
-        // Found by reading Numpy source code RNG values
-        // in (random/mtrand/randomkit.c),
-        // but the random generator type is not explicitly mentioned.
-        using default_numpy_generator_t = std::mt19937;
-        std::random_device rd;
-        default_numpy_generator_t generator(rd());
+        // Numpy uses a Mersenne twister, but a counter based generator lets
+        // each thread and each block of an array fill draw from its own
+        // stream.
+        using default_numpy_generator_t = utils::philox4x32;
+        utils::random_state state;
+
+        // streams of the calling thread
+        utils::thread_random &local_random();
+
+        // scalar generator of the calling thread
+        default_numpy_generator_t &generator();
+
+        template <class T, class Draw>
+        void fill(T *first, long size, Draw const &draw);
       }
     }
   }
@@ -0,0 +1,22 @@
+#ifndef PYTHONIC_INCLUDE_NUMPY_RANDOM_SEED_HPP
+#define PYTHONIC_INCLUDE_NUMPY_RANDOM_SEED_HPP
+
+#include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/types/NoneType.hpp"
+#include "pythonic/include/numpy/random/generator.hpp"
+
+namespace pythonic
+{
+  namespace numpy
+  {
+    namespace random
+    {
+      types::none_type seed(long s);
+      types::none_type seed(types::none_type _ = types::none_type());
+
+      DECLARE_FUNCTOR(pythonic::numpy::random, seed);
+    }
+  }
+}
+
+#endif
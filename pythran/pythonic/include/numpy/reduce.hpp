@@ -11,6 +11,29 @@
 
 #include <algorithm>
 
+// Reductions are computed by splitting the input in chunks of
+// PYTHRAN_REDUCE_CHUNK_SIZE elements, reduced independently (and possibly in
+// parallel) using a pairwise scheme over blocks of PYTHRAN_REDUCE_BLOCK_SIZE
+// elements. Partial results are then combined pairwise too. The combination
+// order only depends on the input shape, not on the number of threads.
+#ifndef PYTHRAN_REDUCE_BLOCK_SIZE
+#define PYTHRAN_REDUCE_BLOCK_SIZE 128
+#endif
+
+#ifndef PYTHRAN_REDUCE_CHUNK_SIZE
+#define PYTHRAN_REDUCE_CHUNK_SIZE (1 << 14)
+#endif
+
+// maximal number of parts reductions along the first axis are split in
+#ifndef PYTHRAN_REDUCE_ROW_PARTS
+#define PYTHRAN_REDUCE_ROW_PARTS 64
+#endif
+
+// number of partial results kept on the stack, more are heap allocated
+#ifndef PYTHRAN_REDUCE_STACK_PARTIALS
+#define PYTHRAN_REDUCE_STACK_PARTIALS 32
+#endif
+
 namespace pythonic
 {
 
@@ -2,10 +2,27 @@
 #define PYTHONIC_INCLUDE_NUMPY_SORT_HPP
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 
+/* Lanes longer than this are sorted with a radix sort when their dtype
+ * allows it, and with std::sort otherwise.
+ */
+#ifndef PYTHRAN_RADIX_SORT_THRESHOLD
+#define PYTHRAN_RADIX_SORT_THRESHOLD 1024
+#endif
+
+/* Number of lanes gathered together when sorting along a non-contiguous
+ * axis, so that each row of the array is read a cache line at a time.
+ */
+#ifndef PYTHRAN_SORT_LANE_BLOCK
+#define PYTHRAN_SORT_LANE_BLOCK 16
+#endif
+
 namespace pythonic
 {
   namespace numpy
@@ -17,6 +34,91 @@ namespace pythonic
     template <class T>
     bool _comp(std::complex<T> const &i, std::complex<T> const &j);
 
+    namespace details
+    {
+
+      /* Maps a value to an unsigned key whose natural ordering matches the
+       * ordering of the values. Only defined for arithmetic types.
+       */
+      template <size_t N>
+      struct radix_uint;
+
+      template <class T, class Enable = void>
+      struct radix_traits {
+        static const bool value = false;
+      };
+
+      template <class T>
+      struct radix_traits<
+          T, typename std::enable_if<std::is_integral<T>::value>::type> {
+        static const bool value = true;
+        using key_type = typename radix_uint<sizeof(T)>::type;
+        static key_type key(T v);
+      };
+
+      template <class T>
+      struct radix_traits<
+          T, typename std::enable_if<std::is_floating_point<T>::value and
+                                     (sizeof(T) == 4 or
+                                      sizeof(T) == 8)>::type> {
+        static const bool value = true;
+        using key_type = typename radix_uint<sizeof(T)>::type;
+        static key_type key(T v);
+      };
+
+      /* Stable LSD radix sort of [first, last), using ``tmp'' as a buffer of
+       * the same size. If ``payload'' is not null, it is permuted along with
+       * the values, using ``ptmp'' as a buffer.
+       */
+      template <class T>
+      void radix_sort(T *first, T *last, T *tmp, long *payload, long *ptmp);
+
+      /* Growable uninitialized buffer, unlike std::vector<bool> it always
+       * provides contiguous storage. Copies start empty.
+       */
+      template <class T>
+      class scratch_buffer
+      {
+        std::unique_ptr<T[]> data_;
+        long capacity_;
+
+      public:
+        scratch_buffer();
+        scratch_buffer(scratch_buffer const &);
+        // pointer to at least ``n'' elements, previous content is lost
+        T *get(long n);
+      };
+
+      /* Sorts lanes, keeping the scratch memory needed by the radix sort
+       * from one lane to another.
+       */
+      template <class T>
+      struct sorter {
+        scratch_buffer<T> tmp;
+        scratch_buffer<long> ptmp;
+
+        // sort [first, last) in place
+        void sort(T *first, T *last);
+
+        // fill ``order'' with the indices that stably sort [first, last),
+        // and sort [first, last)
+        void argsort(T *first, T *last, long *order);
+      };
+
+      /* Calls ``kernel(first, last, lane)'' on each lane of ``arr'' along
+       * ``axis'', where [first, last) is a contiguous view of the lane and
+       * ``lane'' its index in the row-major order of the remaining axes.
+       *
+       * Lanes along the last axis are processed in place; other lanes are
+       * gathered by blocks into a scratch buffer, and scattered back once the
+       * kernel has run. Independent lanes are processed in parallel, each
+       * thread working on its own copy of ``kernel''.
+       */
+      template <class T, size_t N, class K>
+      void for_each_lane(types::ndarray<T, N> &arr, long axis,
+                         K const &kernel);
+    }
+
     template <class T, size_t N>
     void _sort(types::ndarray<T, N> &out, long axis);
 
@@ -4,44 +4,52 @@
 #include "pythonic/include/utils/functor.hpp"
 #include "pythonic/include/types/ndarray.hpp"
 #include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/numpy/sort.hpp"
 
 namespace pythonic
 {
 
   namespace numpy
   {
-    template <class I, class O>
-    void _unique1(I begin, I end, O &out, utils::int_<1>);
-
-    template <class I, class O, size_t N>
-    void _unique1(I begin, I end, O &out, utils::int_<N>);
+    namespace details
+    {
+      template <class I, class T>
+      void unique_flatten(I begin, I end, T *&out, utils::int_<1>);
+
+      template <class I, class T, size_t N>
+      void unique_flatten(I begin, I end, T *&out, utils::int_<N>);
+
+      // equality where nan compare equal, so that they are merged
+      template <class T>
+      bool unique_equal(T const &self, T const &other);
+
+      /* unique values of ``expr'' along with the index of their first
+       * occurrence, the inverse mapping and their counts
+       */
+      template <class E>
+      std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
+                 types::ndarray<long, 1>, types::ndarray<long, 1>>
+      unique(E const &expr);
+    }
 
     template <class E>
     types::ndarray<typename E::dtype, 1> unique(E const &expr);
 
-    template <class I, class O0, class O1>
-    void _unique2(I begin, I end, O0 &out0, O1 &out1, long &i, utils::int_<1>);
-
-    template <class I, class O0, class O1, size_t N>
-    void _unique2(I begin, I end, O0 &out0, O1 &out1, long &i, utils::int_<N>);
-
     template <class E>
     std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>>
     unique(E const &expr, bool return_index);
 
-    template <class I, class O0, class O1, class O2>
-    void _unique3(I begin, I end, O0 &out0, O1 &out1, O2 &out2, long &i,
-                  utils::int_<1>);
-
-    template <class I, class O0, class O1, class O2, size_t N>
-    void _unique3(I begin, I end, O0 &out0, O1 &out1, O2 &out2, long &i,
-                  utils::int_<N>);
-
     template <class E>
     std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
                types::ndarray<long, 1>>
     unique(E const &expr, bool return_index, bool return_inverse);
 
+    template <class E>
+    std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
+               types::ndarray<long, 1>, types::ndarray<long, 1>>
+    unique(E const &expr, bool return_index, bool return_inverse,
+           bool return_counts);
+
     DECLARE_FUNCTOR(pythonic::numpy, unique)
   }
 }
@@ -2,6 +2,7 @@
 #define PYTHONIC_INCLUDE_RANDOM_RANDOM_HPP
 
 #include "pythonic/include/utils/functor.hpp"
+#include "pythonic/include/utils/philox.hpp"
 #include <random>
 
 namespace pythonic
@@ -10,7 +11,14 @@ namespace pythonic
   namespace random
   {
 
-    static std::mt19937 __random_generator;
+    namespace details
+    {
+      utils::random_state state;
+    }
+
+    // generator of the calling thread
+    utils::philox4x32 &__random_generator();
+
 
     double random();
 
@@ -8,6 +8,7 @@
 #include "pythonic/include/utils/shared_ref.hpp"
 #include "pythonic/include/utils/iterator.hpp"
 #include "pythonic/include/utils/reserve.hpp"
+#include "pythonic/include/utils/flat_hash_table.hpp"
 
 #include "pythonic/include/__builtin__/None.hpp"
 
@@ -16,7 +17,9 @@
 #include <limits>
 #include <algorithm>
 #include <iterator>
+#ifdef PYTHRAN_DICT_USE_BOOST_UNORDERED
 #include <boost/unordered_map.hpp>
+#endif
 
 namespace pythonic
 {
@@ -97,7 +100,11 @@ namespace pythonic
           typename std::remove_reference<K>::type>::type;
       using _value_type = typename std::remove_cv<
           typename std::remove_reference<V>::type>::type;
+#ifdef PYTHRAN_DICT_USE_BOOST_UNORDERED
       using container_type = boost::unordered_map<_key_type, _value_type>;
+#else
+      using container_type = utils::flat_hash_map<_key_type, _value_type>;
+#endif
 
       utils::shared_ref<container_type> data;
 
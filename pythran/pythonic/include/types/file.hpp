@@ -18,6 +18,8 @@
 #include <string>
 #include <cstdio>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 namespace pythonic
 {
@@ -32,7 +34,7 @@ namespace pythonic
     private:
       file &f;
       types::str curr;
-      int position;
+      long position;
 
     public:
       using value_type = types::str;
@@ -51,9 +53,19 @@ namespace pythonic
 
     struct _file {
       FILE *f;
+      // With PYTHRAN_FILE_MMAP, files opened for reading only are mapped in
+      // memory and read from the mapping, `f' is then only used for its file
+      // descriptor.
+      char const *map;
+      long map_size, map_pos;
+      // Otherwise, lines are read through getline in a buffer owned by the
+      // file and reused from one line to the next.
+      char *line;
+      size_t line_capacity;
       _file();
       _file(types::str const &filename, types::str const &strmode = "r");
       FILE *operator*() const;
+      void close();
       ~_file();
     };
 
@@ -102,17 +114,17 @@ namespace pythonic
 
       types::str next();
 
-      types::str read(int size = -1);
+      types::str read(long size = -1);
 
       types::str readline(long size = std::numeric_limits<long>::max());
 
       types::list<types::str> readlines(int sizehint = -1);
 
-      void seek(int offset, int whence = SEEK_SET);
+      void seek(long offset, int whence = SEEK_SET);
 
-      int tell() const;
+      long tell() const;
 
-      void truncate(int size = -1);
+      void truncate(long size = -1);
 
       void write(types::str const &str);
 
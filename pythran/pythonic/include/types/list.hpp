@@ -119,6 +119,8 @@ namespace pythonic
       long size() const;
 
       // accessor
+      T const &fast(long i) const;
+      T &fast(long i);
       T const &operator[](long i) const;
       T &operator[](long i);
 
@@ -282,6 +284,8 @@ namespace pythonic
       template <class F>
       list<T> &operator+=(list<F> const &s);
       long size() const;
+      // true if no other list or view shares the elements
+      bool unique() const;
       template <class E>
       long _flat_size(E const &e, utils::int_<1>) const;
       template <class E, size_t L>
@@ -37,6 +37,7 @@
 #include "pythonic/include/types/numpy_texpr.hpp"
 #include "pythonic/include/types/numpy_iexpr.hpp"
 #include "pythonic/include/types/numpy_gexpr.hpp"
+#include "pythonic/include/types/numpy_sexpr.hpp"
 #include "pythonic/include/utils/numpy_traits.hpp"
 
 #include "pythonic/include/__builtin__/len.hpp"
@@ -184,6 +185,21 @@ namespace pythonic
           -> decltype(std::forward<A>(self)[indices[M - 1]]);
     };
 
+    /* Same as nget, without bound wrapping: indices must be positive. */
+    template <size_t L>
+    struct nfast {
+      template <class A, size_t M>
+      auto operator()(A &&self, array<long, M> const &indices)
+          -> decltype(nfast<L - 1>()(std::forward<A>(self).fast(0), indices));
+    };
+
+    template <>
+    struct nfast<0> {
+      template <class A, size_t M>
+      auto operator()(A &&self, array<long, M> const &indices)
+          -> decltype(std::forward<A>(self).fast(indices[M - 1]));
+    };
+
     template <size_t L>
     struct noffset {
       template <size_t M>
@@ -292,6 +308,9 @@ namespace pythonic
       template <class Arg, class F>
       ndarray(numpy_fexpr<Arg, F> const &expr);
 
+      template <class Tp>
+      ndarray(numpy_sexpr<Tp, N> const &expr);
+
       /* update operators */
       template <class Op, class Expr>
       ndarray &update_(Expr const &expr);
@@ -342,6 +361,19 @@ namespace pythonic
           auto operator[](array<long, M> const &indices) &&
           -> decltype(nget<M - 1>()(std::move(*this), indices));
 
+      /* fast(array) does not perform bound wrapping, [array] does */
+      T const &fast(array<long, N> const &indices) const;
+
+      T &fast(array<long, N> const &indices);
+
+      template <size_t M>
+      auto fast(array<long, M> const &indices) const
+          & -> decltype(nfast<M - 1>()(*this, indices));
+
+      template <size_t M>
+          auto fast(array<long, M> const &indices) &&
+          -> decltype(nfast<M - 1>()(std::move(*this), indices));
+
 #ifdef USE_BOOST_SIMD
       using simd_iterator = const_simd_nditerator<ndarray>;
       simd_iterator vbegin() const;
@@ -477,6 +509,11 @@ namespace std
     using type =
         decltype(std::declval<pythonic::types::numpy_gexpr<E, S...>>()[0]);
   };
+
+  template <size_t I, class T, size_t N>
+  struct tuple_element<I, pythonic::types::numpy_sexpr<T, N>> {
+    using type = typename pythonic::types::numpy_sexpr<T, N>::value_type;
+  };
 }
 
 /* pythran attribute system { */
@@ -662,6 +699,35 @@ namespace pythonic
             types::numpy_texpr<decltype(getattr<attr::IMAG, E>{}(a.arg))>{
                 getattr<attr::IMAG, E>{}(a.arg)});
       };
+
+      // strided views know their strides, and their real and imaginary
+      // parts are strided views too
+      template <class T, size_t N>
+      struct getattr<attr::STRIDES, types::numpy_sexpr<T, N>> {
+        array<long, N> operator()(types::numpy_sexpr<T, N> const &a);
+      };
+
+      template <class T, size_t N>
+      struct getattr<attr::REAL, types::numpy_sexpr<T, N>> {
+        using stype = typename types::is_complex<T>::type;
+        types::numpy_sexpr<T, N> make_part(types::numpy_sexpr<T, N> const &a,
+                                           utils::int_<0>);
+        types::numpy_sexpr<stype, N>
+        make_part(types::numpy_sexpr<T, N> const &a, utils::int_<1>);
+        auto operator()(types::numpy_sexpr<T, N> const &a) -> decltype(
+            this->make_part(a, utils::int_<types::is_complex<T>::value>{}));
+      };
+
+      template <class T, size_t N>
+      struct getattr<attr::IMAG, types::numpy_sexpr<T, N>> {
+        using stype = typename types::is_complex<T>::type;
+        types::ndarray<T, N> make_part(types::numpy_sexpr<T, N> const &a,
+                                       utils::int_<0>);
+        types::numpy_sexpr<stype, N>
+        make_part(types::numpy_sexpr<T, N> const &a, utils::int_<1>);
+        auto operator()(types::numpy_sexpr<T, N> const &a) -> decltype(
+            this->make_part(a, utils::int_<types::is_complex<T>::value>{}));
+      };
     }
   }
   namespace __builtin__
@@ -689,6 +755,10 @@ namespace pythonic
     template <int I, class A>
     auto getattr(types::numpy_texpr<A> const &f)
         -> decltype(types::__ndarray::getattr<I, types::numpy_texpr<A>>()(f));
+
+    template <int I, class T, size_t N>
+    auto getattr(types::numpy_sexpr<T, N> const &f) -> decltype(
+        types::__ndarray::getattr<I, types::numpy_sexpr<T, N>>()(f));
   }
 }
 
@@ -748,18 +818,21 @@ namespace pythonic
     static PyObject *convert(types::numpy_gexpr<Arg, S...> const &v);
   };
 
+  template <class T, size_t N>
+  struct to_python<types::numpy_sexpr<T, N>> {
+    static PyObject *convert(types::numpy_sexpr<T, N> const &v);
+  };
+
   template <typename T, size_t N>
   struct from_python<types::ndarray<T, N>> {
     static bool is_convertible(PyObject *obj);
     static types::ndarray<T, N> convert(PyObject *obj);
   };
 
-  template <typename T, size_t N, class... S>
-  struct from_python<types::numpy_gexpr<types::ndarray<T, N>, S...>> {
+  template <typename T, size_t N>
+  struct from_python<types::numpy_sexpr<T, N>> {
     static bool is_convertible(PyObject *obj);
-
-    static types::numpy_gexpr<types::ndarray<T, N>, S...>
-    convert(PyObject *obj);
+    static types::numpy_sexpr<T, N> convert(PyObject *obj);
   };
 
   template <typename E>
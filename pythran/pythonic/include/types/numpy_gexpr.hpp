@@ -99,6 +99,9 @@ namespace pythonic
 
     template <size_t L>
     struct nget;
+
+    template <size_t L>
+    struct nfast;
     /* manually unrolled copy function
      */
     template <size_t I>
@@ -300,6 +303,10 @@ namespace pythonic
     struct may_overlap_gexpr<ndarray<T, N>> : std::false_type {
     };
 
+    template <class T, class B>
+    struct may_overlap_gexpr<broadcast<T, B>> : std::false_type {
+    };
+
     template <class E>
     struct may_overlap_gexpr<numpy_iexpr<E>> : may_overlap_gexpr<E> {
     };
@@ -546,6 +553,14 @@ namespace pythonic
           auto operator[](array<long, M> const &indices) &&
           -> decltype(nget<M - 1>()(std::move(*this), indices));
 
+      template <size_t M>
+      auto fast(array<long, M> const &indices) const
+          & -> decltype(nfast<M - 1>()(*this, indices));
+
+      template <size_t M>
+          auto fast(array<long, M> const &indices) &&
+          -> decltype(nfast<M - 1>()(std::move(*this), indices));
+
       template <class F>
       typename std::enable_if<is_numexpr_arg<F>::value,
                               numpy_fexpr<numpy_gexpr, F>>::type
@@ -195,6 +195,8 @@ namespace pythonic
 
       dtype const &operator[](array<long, value> const &indices) const;
       dtype &operator[](array<long, value> const &indices);
+      dtype const &fast(array<long, value> const &indices) const;
+      dtype &fast(array<long, value> const &indices);
 
       long flat_size() const;
       array<long, value> const &shape() const;
@@ -0,0 +1,214 @@
+#ifndef PYTHONIC_INCLUDE_TYPES_NUMPY_SEXPR_HPP
+#define PYTHONIC_INCLUDE_TYPES_NUMPY_SEXPR_HPP
+
+#include "pythonic/include/types/nditerator.hpp"
+#include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/types/slice.hpp"
+#include "pythonic/include/types/raw_array.hpp"
+#include "pythonic/include/types/traits.hpp"
+#include "pythonic/include/utils/int_.hpp"
+#include "pythonic/include/utils/shared_ref.hpp"
+
+namespace pythonic
+{
+
+  namespace types
+  {
+
+    template <class T, size_t N>
+    struct ndarray;
+
+    template <class... Types>
+    struct count_long;
+
+    template <class T, size_t N>
+    struct numpy_sexpr_helper;
+
+    namespace details
+    {
+      // apply ``Op'' to each element of a strided buffer and ``value''
+      template <class Op, class T, class V>
+      void strided_update(T *buffer, long const *shape, long const *strides,
+                          V const &value, utils::int_<1>);
+      template <class Op, class T, class V, size_t N>
+      void strided_update(T *buffer, long const *shape, long const *strides,
+                          V const &value, utils::int_<N>);
+    }
+
+    /* Strided view over a memory buffer
+     *
+     * Each dimension has its own stride, counted in elements, possibly
+     * negative. This is how numpy arrays that are not C-contiguous
+     * (Fortran-ordered arrays, views with steps, swapped axes...) are passed
+     * to pythran functions, without copying them.
+     *
+     * Indexing a view yields a view of lower dimension, slicing it yields a
+     * view of the same dimension.
+     */
+    template <class T, size_t N>
+    struct numpy_sexpr {
+      static constexpr size_t value = N;
+      static const bool is_vectorizable = false;
+      static const bool is_strided = true;
+      using dtype = T;
+      using value_type = typename numpy_sexpr_helper<T, N>::type;
+
+      using iterator = nditerator<numpy_sexpr>;
+      using const_iterator = const_nditerator<numpy_sexpr>;
+
+      utils::shared_ref<raw_array<T>> mem; // keeps the memory alive
+      T *buffer;                            // address of the first element
+      array<long, N> _shape;
+      array<long, N> _strides;
+
+      numpy_sexpr();
+      numpy_sexpr(numpy_sexpr const &) = default;
+      numpy_sexpr(numpy_sexpr &&) = default;
+
+      numpy_sexpr(utils::shared_ref<raw_array<T>> const &mem, T *buffer,
+                  array<long, N> const &shape, array<long, N> const &strides);
+
+      // view over a whole array
+      numpy_sexpr(ndarray<T, N> const &arr);
+
+      template <class E>
+      numpy_sexpr &operator=(E const &expr);
+      numpy_sexpr &operator=(numpy_sexpr const &expr);
+
+      template <class Op, class E>
+      typename std::enable_if<not is_dtype<E>::value, numpy_sexpr &>::type
+      update_(E const &expr);
+      // scalars are applied element by element
+      template <class Op, class E>
+      typename std::enable_if<is_dtype<E>::value, numpy_sexpr &>::type
+      update_(E const &expr);
+
+      template <class E>
+      numpy_sexpr &operator+=(E const &expr);
+
+      template <class E>
+      numpy_sexpr &operator-=(E const &expr);
+
+      template <class E>
+      numpy_sexpr &operator*=(E const &expr);
+
+      template <class E>
+      numpy_sexpr &operator/=(E const &expr);
+
+      template <class E>
+      numpy_sexpr &operator&=(E const &expr);
+
+      template <class E>
+      numpy_sexpr &operator|=(E const &expr);
+
+      const_iterator begin() const;
+      const_iterator end() const;
+
+      iterator begin();
+      iterator end();
+
+      /* fast(long) does not perform bound wrapping, [long] does */
+      auto fast(long i) const
+          -> decltype(numpy_sexpr_helper<T, N>::get(*this, i));
+      auto fast(long i) -> decltype(numpy_sexpr_helper<T, N>::get(*this, i));
+
+      auto operator[](long i) const -> decltype(this->fast(i));
+      auto operator[](long i) -> decltype(this->fast(i));
+      auto operator()(long i) const -> decltype(this->fast(i));
+      auto operator()(long i) -> decltype(this->fast(i));
+
+      T const &operator[](array<long, N> const &indices) const;
+      T &operator[](array<long, N> const &indices);
+      T const &fast(array<long, N> const &indices) const;
+      T &fast(array<long, N> const &indices);
+
+      numpy_sexpr operator[](slice const &s0) const;
+      numpy_sexpr operator[](contiguous_slice const &s0) const;
+
+    private:
+      template <class... S>
+      T &_get(utils::int_<1>, S const &... s) const;
+      template <class... S>
+      numpy_sexpr<T, N - count_long<S...>::value> _get(utils::int_<0>,
+                                                       S const &... s) const;
+
+      // apply each index to the dimension ``in'' of this view, filling the
+      // dimension ``out'' of ``res'' for slices
+      template <class R>
+      void _apply(R &res, size_t in, size_t out) const;
+      template <class R, class... S>
+      void _apply(R &res, size_t in, size_t out, long i,
+                  S const &... s) const;
+      template <class R, class S0, class... S>
+      void _apply(R &res, size_t in, size_t out, S0 const &s0,
+                  S const &... s) const;
+
+    public:
+      /* any combination of integers and slices: integers remove a
+       * dimension, slices restrict it */
+      template <class S0, class S1, class... S>
+      auto operator()(S0 const &s0, S1 const &s1, S const &... s) const
+          -> decltype(this->_get(
+              utils::int_<count_long<S0, S1, S...>::value == N>(), s0, s1,
+              s...));
+      numpy_sexpr operator()(slice const &s0) const;
+      numpy_sexpr operator()(contiguous_slice const &s0) const;
+
+      long size() const;
+      long flat_size() const;
+      array<long, N> const &shape() const;
+      intptr_t id() const;
+      ndarray<T, N> copy() const;
+    };
+
+    // Indexing a view of more than one dimension yields a view
+    template <class T, size_t N>
+    struct numpy_sexpr_helper {
+      using type = numpy_sexpr<T, N - 1>;
+      static type get(numpy_sexpr<T, N> const &e, long i);
+    };
+
+    // Indexing a view of one dimension yields an element
+    template <class T>
+    struct numpy_sexpr_helper<T, 1> {
+      using type = T;
+      static T const &get(numpy_sexpr<T, 1> const &e, long i);
+      static T &get(numpy_sexpr<T, 1> &e, long i);
+    };
+  }
+}
+
+/* type inference stuff  {*/
+#include "pythonic/include/types/combined.hpp"
+
+template <class T, size_t N>
+struct __combined<pythonic::types::numpy_sexpr<T, N>,
+                  pythonic::types::numpy_sexpr<T, N>> {
+  using type = pythonic::types::numpy_sexpr<T, N>;
+};
+
+template <class T, size_t N, class O>
+struct __combined<pythonic::types::numpy_sexpr<T, N>, O> {
+  using type = pythonic::types::numpy_sexpr<T, N>;
+};
+
+template <class T, size_t N, class O>
+struct __combined<O, pythonic::types::numpy_sexpr<T, N>> {
+  using type = pythonic::types::numpy_sexpr<T, N>;
+};
+
+/* combined are sorted such that the assigned type comes first */
+template <class T, size_t N, class Tp, size_t Np>
+struct __combined<pythonic::types::numpy_sexpr<T, N>,
+                  pythonic::types::ndarray<Tp, Np>> {
+  using type = pythonic::types::numpy_sexpr<T, N>;
+};
+
+template <class T, size_t N, class Tp, size_t Np>
+struct __combined<pythonic::types::ndarray<Tp, Np>,
+                  pythonic::types::numpy_sexpr<T, N>> {
+  using type = pythonic::types::ndarray<Tp, Np>;
+};
+
+/*}*/
+#endif
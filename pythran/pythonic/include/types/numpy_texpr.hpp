@@ -81,6 +81,10 @@ namespace pythonic
           -> decltype(arg[array<long, 2>{{indices[1], indices[0]}}]);
       auto operator[](array<long, value> const &indices) const
           -> decltype(arg[array<long, 2>{{indices[1], indices[0]}}]);
+      auto fast(array<long, value> const &indices)
+          -> decltype(arg.fast(array<long, 2>{{indices[1], indices[0]}}));
+      auto fast(array<long, value> const &indices) const
+          -> decltype(arg.fast(array<long, 2>{{indices[1], indices[0]}}));
 
       auto operator()(contiguous_slice const &s0) const
           -> decltype(this->arg(contiguous_slice(pythonic::__builtin__::None,
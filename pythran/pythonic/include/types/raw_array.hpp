@@ -1,6 +1,8 @@
 #ifndef PYTHONIC_INCLUDE_TYPES_RAW_ARRAY_HPP
 #define PYTHONIC_INCLUDE_TYPES_RAW_ARRAY_HPP
 
+#include "pythonic/include/utils/allocate.hpp"
+
 namespace pythonic
 {
 
@@ -19,6 +21,7 @@ namespace pythonic
       using pointer_type = T *;
 
       T *data;
+      size_t nbytes; // 0 if data was not allocated through utils::allocate
       raw_array();
       raw_array(size_t n);
       raw_array(T *d);
@@ -5,13 +5,13 @@
 #include "pythonic/include/types/empty_iterator.hpp"
 #include "pythonic/include/types/list.hpp"
 
+#include "pythonic/include/utils/flat_hash_table.hpp"
 #include "pythonic/include/utils/iterator.hpp"
 #include "pythonic/include/utils/reserve.hpp"
 #include "pythonic/include/utils/shared_ref.hpp"
 
 #include "pythonic/include/__builtin__/in.hpp"
 
-#include <set>
 #include <memory>
 #include <utility>
 #include <limits>
@@ -117,6 +117,26 @@ namespace pythonic
   namespace types
   {
 
+    namespace details
+    {
+      // whether ``value'' is in each of ``others''
+      template <class V>
+      bool in_all(V const &value);
+      template <class V, class U, class... Types>
+      bool in_all(V const &value, U const &other, Types const &... others);
+
+      // add (resp. discard) the elements of each of ``others'' to ``s''
+      template <class S>
+      void insert_all(S &s);
+      template <class S, class U, class... Types>
+      void insert_all(S &s, U const &other, Types const &... others);
+
+      template <class S>
+      void discard_all(S &s);
+      template <class S, class U, class... Types>
+      void discard_all(S &s, U const &other, Types const &... others);
+    }
+
     template <class T>
     class set
     {
@@ -124,7 +144,7 @@ namespace pythonic
       // data holder
       using _type = typename std::remove_cv<
           typename std::remove_reference<T>::type>::type;
-      using container_type = std::set<_type>;
+      using container_type = utils::flat_hash_set<_type>;
       utils::shared_ref<container_type> data;
 
     public:
@@ -144,9 +164,6 @@ namespace pythonic
       using allocator_type = typename container_type::allocator_type;
       using pointer = typename container_type::pointer;
       using const_pointer = typename container_type::const_pointer;
-      using reverse_iterator = typename container_type::reverse_iterator;
-      using const_reverse_iterator =
-          typename container_type::const_reverse_iterator;
 
       // constructors
       set();
@@ -163,10 +180,6 @@ namespace pythonic
       const_iterator begin() const;
       iterator end();
       const_iterator end() const;
-      reverse_iterator rbegin();
-      const_reverse_iterator rbegin() const;
-      reverse_iterator rend();
-      const_reverse_iterator rend() const;
 
       // modifiers
       T pop();
@@ -14,6 +14,7 @@
 #include <cassert>
 #include <string>
 #include <cstring>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
 
@@ -44,6 +45,8 @@ namespace pythonic
     class sliced_str
     {
 
+      friend class str;
+
       using container_type = std::string;
       utils::shared_ref<container_type> data;
 
@@ -86,6 +89,8 @@ namespace pythonic
       long size() const;
 
       // accessor
+      char const &fast(long i) const;
+      char &fast(long i);
       char const &operator[](long i) const;
       char &operator[](long i);
       sliced_str<slice> operator[](slice const &s) const;
@@ -112,15 +117,26 @@ namespace pythonic
       friend class sliced_str;
 
       using container_type = std::string;
-      utils::shared_ref<container_type> data;
+      // A str is a view on [offset, offset + length) of a shared buffer, so
+      // that slices, split tokens and strip results do not copy their parent.
+      // Members that modify the string first copy it to a buffer of its own,
+      // c_str() does so for views that are not null terminated.
+      mutable utils::shared_ref<container_type> data;
+      mutable size_t offset;
+      size_t length;
+
+      str(utils::shared_ref<container_type> const &data, size_t offset,
+          size_t length);
+      void own();
 
     public:
       static const size_t npos = std::string::npos;
 
       using value_type = str; // in Python, a string contains... strings
-      using iterator = container_type::iterator;
-      using reverse_iterator = container_type::reverse_iterator;
-      using const_reverse_iterator = container_type::const_reverse_iterator;
+      using iterator = char const *;
+      using const_iterator = char const *;
+      using reverse_iterator = std::reverse_iterator<char const *>;
+      using const_reverse_iterator = std::reverse_iterator<char const *>;
 
       str();
       str(std::string const &s);
@@ -143,19 +159,14 @@ namespace pythonic
 
       types::str &operator+=(types::str const &s);
 
-      container_type const &get_data() const;
-
       long size() const;
-      auto begin() const -> decltype(data->begin());
-      auto begin() -> decltype(data->begin());
-      auto rbegin() const -> decltype(data->rbegin());
-      auto rbegin() -> decltype(data->rbegin());
-      auto end() const -> decltype(data->end());
-      auto end() -> decltype(data->end());
-      auto rend() const -> decltype(data->rend());
-      auto rend() -> decltype(data->rend());
-      auto c_str() const -> decltype(data->c_str());
-      auto resize(long n) -> decltype(data->resize(n));
+      char const *chars() const;
+      const_iterator begin() const;
+      const_reverse_iterator rbegin() const;
+      const_iterator end() const;
+      const_reverse_iterator rend() const;
+      char const *c_str() const;
+      void resize(long n);
       long find(str const &s, size_t pos = 0) const;
       bool contains(str const &v) const;
       long find_first_of(str const &s, size_t pos = 0) const;
@@ -181,14 +192,13 @@ namespace pythonic
       sliced_str<slice> operator()(slice const &s) const;
       sliced_str<contiguous_slice> operator()(contiguous_slice const &s) const;
 
+      char fast(long i) const;
       char operator[](long i) const;
-      char &operator[](long i);
 
       sliced_str<slice> operator[](slice const &s) const;
       sliced_str<contiguous_slice> operator[](contiguous_slice const &s) const;
 #ifdef USE_GMP
       char operator[](pythran_long_t const &m) const;
-      char &operator[](pythran_long_t const &m);
 #endif
 
       explicit operator bool() const;
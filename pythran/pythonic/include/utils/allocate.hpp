@@ -0,0 +1,79 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_ALLOCATE_HPP
+#define PYTHONIC_INCLUDE_UTILS_ALLOCATE_HPP
+
+#include <cstddef>
+#include <cstdlib>
+
+/* Memory allocation backend used for raw_array, i.e. ndarray buffers.
+ *
+ * Selected at compile time through ``PYTHRAN_ALLOCATOR'':
+ *
+ * - ``PYTHRAN_MALLOC_ALLOCATOR'' plain ``malloc'', no alignment guarantee
+ * - ``PYTHRAN_ALIGNED_ALLOCATOR'' ``PYTHRAN_ALLOCATOR_ALIGNMENT'' aligned
+ *   allocations
+ * - ``PYTHRAN_POOLED_ALLOCATOR'' aligned allocations, rounded up to a power
+ *   of two and recycled through a per-thread pool of free blocks
+ *
+ * Whatever the backend, the returned memory can be released with ``free'',
+ * which makes it possible to hand it over to numpy.
+ */
+#define PYTHRAN_MALLOC_ALLOCATOR 0
+#define PYTHRAN_ALIGNED_ALLOCATOR 1
+#define PYTHRAN_POOLED_ALLOCATOR 2
+
+// vectorized code checks the alignment of the buffers it reads at run time,
+// so aligned allocations, which are slower, are opt-in
+#ifndef PYTHRAN_ALLOCATOR
+#define PYTHRAN_ALLOCATOR PYTHRAN_MALLOC_ALLOCATOR
+#endif
+
+// a cache line, which is also wide enough for any SIMD register up to AVX-512
+#ifndef PYTHRAN_ALLOCATOR_ALIGNMENT
+#define PYTHRAN_ALLOCATOR_ALIGNMENT 64
+#endif
+
+// number of free blocks kept per size class and per thread
+#ifndef PYTHRAN_POOL_DEPTH
+#define PYTHRAN_POOL_DEPTH 4
+#endif
+
+// blocks larger than this (in bytes) are never pooled
+#ifndef PYTHRAN_POOL_MAX_SIZE
+#define PYTHRAN_POOL_MAX_SIZE (1UL << 26)
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    /* allocate memory for ``n'' elements of type ``T'', without
+     * initializing them
+     */
+    template <class T>
+    T *allocate(size_t n);
+
+    /* give back memory obtained from ``allocate<T>(n)'' */
+    template <class T>
+    void deallocate(T *ptr, size_t n);
+
+    /* true if ``ptr'' is a multiple of ``alignment'' */
+    bool is_aligned(void const *ptr,
+                    size_t alignment = PYTHRAN_ALLOCATOR_ALIGNMENT);
+
+#ifdef PYTHRAN_ALLOCATOR_STATS
+    /* allocation counters, dumped on stderr at exit */
+    struct allocator_stats {
+      size_t requests;    // calls to allocate
+      size_t allocations; // calls forwarded to the system allocator
+      size_t pool_hits;   // calls served from the pool
+      ~allocator_stats();
+    };
+
+    allocator_stats &get_allocator_stats();
+#endif
+  }
+}
+
+#endif
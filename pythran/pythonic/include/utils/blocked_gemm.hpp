@@ -0,0 +1,101 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_BLOCKED_GEMM_HPP
+#define PYTHONIC_INCLUDE_UTILS_BLOCKED_GEMM_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+/* Cache-blocked matrix products, for the dtypes BLAS does not handle and the
+ * operands it cannot read in place.
+ *
+ * Operands are read through a pointer and a stride per axis, so that
+ * transposed and sliced matrices are used without a copy. As in BLAS
+ * implementations, a ``kc'' x ``nc'' panel of B and a ``mc'' x ``kc'' block
+ * of A are packed in the order the micro-kernel reads them, which also
+ * converts them to the type of the result. The micro-kernel then computes a
+ * ``mr'' x ``nr'' tile of C in registers, with loops of constant bounds the
+ * compiler turns into SIMD code.
+ */
+
+// rows of A packed at once, kept in the L2 cache
+#ifndef PYTHRAN_GEMM_MC
+#define PYTHRAN_GEMM_MC 128
+#endif
+
+// depth of the packed blocks
+#ifndef PYTHRAN_GEMM_KC
+#define PYTHRAN_GEMM_KC 256
+#endif
+
+// columns of B packed at once, kept in the L3 cache
+#ifndef PYTHRAN_GEMM_NC
+#define PYTHRAN_GEMM_NC 4096
+#endif
+
+// number of multiply-adds from which products run in parallel
+#ifndef PYTHRAN_GEMM_PARALLEL_THRESHOLD
+#define PYTHRAN_GEMM_PARALLEL_THRESHOLD (1L << 18)
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      /* Generic micro-kernel, for the types without vector support.
+       * ``Simd'' selects a kernel written with vectors of the GCC vector
+       * extension, of the largest size the target supports.
+       */
+      template <class T, bool Simd = std::is_arithmetic<T>::value and
+                                     not std::is_same<T, bool>::value>
+      struct gemm_kernel {
+        static const long mr = 4;
+        static const long nr = sizeof(T) >= 32 ? 2 : 64 / sizeof(T);
+
+        /* c[i * c_stride + j] (+)= sum(a[p * mr + i] * b[p * nr + j])
+         * for ``i'' in [0, m) and ``j'' in [0, n)
+         */
+        static void apply(long kc, T const *a, T const *b, T *c,
+                          long c_stride, long m, long n, bool accumulate);
+      };
+
+#ifdef __GNUC__
+      template <class T>
+      struct gemm_kernel<T, true> {
+#ifdef __AVX__
+        static const long vector_size = 32;
+#else
+        static const long vector_size = 16;
+#endif
+        typedef T vector_type __attribute__((vector_size(vector_size)));
+        static const long width = vector_size / sizeof(T);
+
+        // two vectors per row of the tile
+        static const long mr = 6;
+        static const long nr = 2 * width;
+
+        static void apply(long kc, T const *a, T const *b, T *c,
+                          long c_stride, long m, long n, bool accumulate);
+      };
+#endif
+    }
+
+    /* c[i * c_stride + j] = sum(a[i * a_rs + p * a_cs] * b[p * b_rs + j *
+     * b_cs]) for ``i'' in [0, m), ``j'' in [0, n) and ``p'' in [0, k)
+     */
+    template <class A, class B, class C>
+    void gemm(long m, long n, long k, A const *a, long a_rs, long a_cs,
+              B const *b, long b_rs, long b_cs, C *c, long c_stride);
+
+    /* y[i] = sum(a[i * a_rs + j * a_cs] * x[j * x_stride])
+     * for ``i'' in [0, m) and ``j'' in [0, n)
+     */
+    template <class A, class X, class Y>
+    void gemv(long m, long n, A const *a, long a_rs, long a_cs, X const *x,
+              long x_stride, Y *y);
+  }
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_BLOCKED_TRANSPOSE_HPP
+#define PYTHONIC_INCLUDE_UTILS_BLOCKED_TRANSPOSE_HPP
+
+#include "pythonic/include/types/tuple.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+/* Cache-blocked transposition kernels.
+ *
+ * Matrices are transposed tile by tile, so that both the rows read from the
+ * source and the rows written to the destination stay in cache. Within a
+ * tile, 4 and 8 bytes elements are transposed in SIMD registers when SSE2 or
+ * AVX is available.
+ */
+
+// side of a tile, in elements
+#ifndef PYTHRAN_TRANSPOSE_BLOCK
+#define PYTHRAN_TRANSPOSE_BLOCK 32
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      /* In-register transposition of a ``size'' x ``size'' square of
+       * elements of ``Size'' bytes. Only moves bits, so it is valid for any
+       * trivially copyable type of that size.
+       *
+       * ``size'' is 1 when there is no SIMD support for that element size.
+       */
+      template <size_t Size>
+      struct transpose_kernel {
+        static const long size = 1;
+        template <class T>
+        static void apply(T const *src, long src_stride, T *dst,
+                          long dst_stride);
+      };
+
+#if defined(__AVX__) || defined(__SSE2__)
+      template <>
+      struct transpose_kernel<4> {
+#ifdef __AVX__
+        static const long size = 8;
+#else
+        static const long size = 4;
+#endif
+        template <class T>
+        static void apply(T const *src, long src_stride, T *dst,
+                          long dst_stride);
+      };
+
+      template <>
+      struct transpose_kernel<8> {
+#ifdef __AVX__
+        static const long size = 4;
+#else
+        static const long size = 2;
+#endif
+        template <class T>
+        static void apply(T const *src, long src_stride, T *dst,
+                          long dst_stride);
+      };
+#endif
+
+      template <class T, class U>
+      struct has_transpose_kernel
+          : std::integral_constant<
+                bool, std::is_same<T, U>::value and
+                          std::is_arithmetic<T>::value and
+                          (transpose_kernel<sizeof(T)>::size > 1)> {
+      };
+
+      // transpose the rows [r0, r1) and columns [c0, c1) of ``src''
+      template <class T, class U>
+      void transpose_tile(T const *src, long src_stride, U *dst,
+                          long dst_stride, long r0, long r1, long c0, long c1,
+                          std::false_type);
+      template <class T>
+      void transpose_tile(T const *src, long src_stride, T *dst,
+                          long dst_stride, long r0, long r1, long c0, long c1,
+                          std::true_type);
+    }
+
+    /* dst[c * dst_stride + r] = src[r * src_stride + c]
+     * for each ``r'' in [0, rows) and ``c'' in [0, cols)
+     */
+    template <class T, class U>
+    void transpose(T const *src, long src_stride, U *dst, long dst_stride,
+                   long rows, long cols);
+
+    /* copy the C-contiguous array ``src'' of shape ``shape'' into the
+     * C-contiguous array ``dst'', axis ``i'' of ``dst'' being axis
+     * ``axes[i]'' of ``src''
+     */
+    template <class T, class U, size_t N>
+    void permute_axes(T const *src, types::array<long, N> const &shape,
+                      long const *axes, U *dst);
+  }
+}
+
+#endif
@@ -2,6 +2,9 @@
 #define PYTHONIC_INCLUDE_UTILS_BROADCAST_COPY_HPP
 
 #include "pythonic/include/types/tuple.hpp"
+#include "pythonic/include/utils/blocked_transpose.hpp"
+#include "pythonic/include/utils/meta.hpp"
+#include "pythonic/include/utils/numpy_traits.hpp"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -92,8 +95,166 @@ namespace pythonic
       template <class E, class F>
       void operator()(E &&self, F const &other);
     };
+
+    // N-dimensional version: if both sides are dense and no broadcasting
+    // happens, all dimensions are collapsed into a single vectorized loop.
+    // Otherwise the copy is performed row by row, the innermost dimension
+    // being vectorized through _broadcast_copy<true, 1, 0>
+    template <size_t N>
+    struct _broadcast_copy<true, N, 0> {
+      template <class E, class F>
+      void operator()(E &&self, F const &other);
+
+      template <class E, class F>
+      void flat_copy(E &&self, F const &other, utils::int_<0>);
+      template <class E, class F>
+      void flat_copy(E &&self, F const &other, utils::int_<1>);
+    };
 #endif
 
+    namespace details
+    {
+      /* Matrix expressions that read a transposed matrix are evaluated tile
+       * by tile, so that both the rows of the destination and the columns of
+       * the transposed operand stay in cache. This applies to expressions
+       * whose leaves are dense matrices, dense vectors, scalars or
+       * transposed dense matrices, element ``(i, j)'' being fetched through
+       * ``tile_get''.
+       */
+      template <class E>
+      struct is_tileable : std::false_type {
+      };
+
+      template <class T>
+      struct is_tileable<types::ndarray<T, 1>> : std::true_type {
+      };
+
+      template <class T>
+      struct is_tileable<types::ndarray<T, 2>> : std::true_type {
+      };
+
+      template <class T>
+      struct is_tileable<types::numpy_texpr<types::ndarray<T, 2>>>
+          : std::true_type {
+      };
+
+      template <class T, class B>
+      struct is_tileable<types::broadcast<T, B>> : std::true_type {
+      };
+
+      template <class Op, class... Args>
+      struct is_tileable<types::numpy_expr<Op, Args...>>
+          : std::integral_constant<
+                bool, utils::all_of<is_tileable<
+                          typename std::decay<Args>::type>::value...>::value> {
+      };
+
+      template <class E>
+      struct has_transpose : std::false_type {
+      };
+
+      template <class T>
+      struct has_transpose<types::numpy_texpr<types::ndarray<T, 2>>>
+          : std::true_type {
+      };
+
+      template <class Op, class... Args>
+      struct has_transpose<types::numpy_expr<Op, Args...>>
+          : std::integral_constant<
+                bool, utils::any_of<has_transpose<
+                          typename std::decay<Args>::type>::value...>::value> {
+      };
+
+      template <class E>
+      struct use_tiles
+          : std::integral_constant<bool, is_tileable<E>::value and
+                                             has_transpose<E>::value> {
+      };
+
+      /* runtime part of the check: each leaf has the shape of the
+       * destination, vectors matching its rows
+       */
+      template <class T>
+      bool tile_compatible(types::ndarray<T, 1> const &e,
+                           types::array<long, 2> const &shape);
+      template <class T>
+      bool tile_compatible(types::ndarray<T, 2> const &e,
+                           types::array<long, 2> const &shape);
+      template <class T>
+      bool tile_compatible(types::numpy_texpr<types::ndarray<T, 2>> const &e,
+                           types::array<long, 2> const &shape);
+      template <class T, class B>
+      bool tile_compatible(types::broadcast<T, B> const &e,
+                           types::array<long, 2> const &shape);
+      template <class Op, class... Args>
+      bool tile_compatible(types::numpy_expr<Op, Args...> const &e,
+                           types::array<long, 2> const &shape);
+      template <class Tuple>
+      bool tile_compatible(Tuple const &args,
+                           types::array<long, 2> const &shape, utils::int_<0>);
+      template <class Tuple, size_t I>
+      bool tile_compatible(Tuple const &args,
+                           types::array<long, 2> const &shape, utils::int_<I>);
+
+      /* true if a transposed leaf of ``e'' shares memory with the range
+       * [lo, hi] of the destination, which requires a temporary copy
+       */
+      template <class E>
+      bool tile_overlap(E const &e, void const *lo, void const *hi);
+      template <class T>
+      bool tile_overlap(types::numpy_texpr<types::ndarray<T, 2>> const &e,
+                        void const *lo, void const *hi);
+      template <class Op, class... Args>
+      bool tile_overlap(types::numpy_expr<Op, Args...> const &e,
+                        void const *lo, void const *hi);
+      template <class Tuple>
+      bool tile_overlap(Tuple const &args, void const *lo, void const *hi,
+                        utils::int_<0>);
+      template <class Tuple, size_t I>
+      bool tile_overlap(Tuple const &args, void const *lo, void const *hi,
+                        utils::int_<I>);
+
+      template <class T>
+      T tile_get(types::ndarray<T, 1> const &e, long i, long j);
+      template <class T>
+      T tile_get(types::ndarray<T, 2> const &e, long i, long j);
+      template <class T>
+      T tile_get(types::numpy_texpr<types::ndarray<T, 2>> const &e, long i,
+                 long j);
+      template <class T, class B>
+      typename types::broadcast<T, B>::dtype
+      tile_get(types::broadcast<T, B> const &e, long i, long j);
+      template <class Op, class... Args, int... I>
+      typename types::numpy_expr<Op, Args...>::dtype
+      tile_get(types::numpy_expr<Op, Args...> const &e, long i, long j,
+               utils::seq<I...>);
+      template <class Op, class... Args>
+      typename types::numpy_expr<Op, Args...>::dtype
+      tile_get(types::numpy_expr<Op, Args...> const &e, long i, long j);
+
+      // assignment, as an in-place operator
+      struct tile_assign {
+        template <class T, class V>
+        void operator()(T &&self, V const &value) const;
+      };
+
+      /* apply ``op'' to each element of ``self'' and the matching element of
+       * ``other'', tile by tile. Returns false, and does nothing, if
+       * ``other'' cannot be evaluated that way.
+       */
+      template <class E, class F, class Op>
+      bool tiled_apply(E &self, F const &other, Op const &op,
+                       std::false_type);
+      template <class E, class F, class Op>
+      bool tiled_apply(E &self, F const &other, Op const &op,
+                       std::true_type);
+      // plain transposition, through the blocked transpose kernel
+      template <class T, class U>
+      bool tiled_apply(types::ndarray<T, 2> &self,
+                       types::numpy_texpr<types::ndarray<U, 2>> const &other,
+                       tile_assign const &op, std::true_type);
+    }
+
     template <class E, class F, size_t N, size_t D, bool vector_form>
     E &broadcast_copy(E &self, F const &other);
 
@@ -126,6 +287,84 @@ namespace pythonic
       template <class E, class F>
       void operator()(E &&self, types::broadcasted<F> const &other);
     };
+
+    // same as _broadcast_copy<true, N, 0>
+    template <class Op, size_t N>
+    struct _broadcast_update<Op, true, N, 0>
+        : _broadcast_update<Op, false, N, 0> {
+      using _broadcast_update<Op, false, N, 0>::operator();
+
+      template <class E, class F>
+      void operator()(E &&self, F const &other);
+
+      template <class E, class F>
+      void flat_update(E &&self, F const &other, utils::int_<0>);
+      template <class E, class F>
+      void flat_update(E &&self, F const &other, utils::int_<1>);
+    };
+
+    namespace details
+    {
+      /* An expression is flat if its elements can be addressed through a
+       * single index running over its whole buffer(s), which requires every
+       * leaf to be dense.
+       */
+      template <class E>
+      struct is_flat : std::false_type {
+      };
+
+      template <class T, size_t N>
+      struct is_flat<types::ndarray<T, N>> : std::true_type {
+      };
+
+      template <class Arg>
+      struct is_flat<types::numpy_iexpr<Arg>>
+          : is_flat<typename std::decay<Arg>::type> {
+      };
+
+      template <class T, class B>
+      struct is_flat<types::broadcast<T, B>> : std::true_type {
+      };
+
+      template <class Op, class... Args>
+      struct is_flat<types::numpy_expr<Op, Args...>>
+          : std::integral_constant<
+                bool,
+                utils::all_of<is_flat<
+                    typename std::decay<Args>::type>::value...>::value> {
+      };
+
+      /* runtime part of the check: no leaf is broadcast along a dimension
+       * of size 1
+       */
+      template <class E>
+      bool no_broadcast(E const &e, long size);
+      template <class T, class B>
+      bool no_broadcast(types::broadcast<T, B> const &e, long size);
+      template <class Op, class... Args>
+      bool no_broadcast(types::numpy_expr<Op, Args...> const &e, long size);
+      template <class Tuple>
+      bool no_broadcast(Tuple const &args, long size, utils::int_<0>);
+      template <class Tuple, size_t I>
+      bool no_broadcast(Tuple const &args, long size, utils::int_<I>);
+
+      /* scalar access to the i-th element of a flat expression */
+      template <class T, size_t N>
+      T flat_get(types::ndarray<T, N> const &e, long i);
+      template <class Arg>
+      typename types::numpy_iexpr<Arg>::dtype
+      flat_get(types::numpy_iexpr<Arg> const &e, long i);
+      template <class T, class B>
+      typename types::broadcast<T, B>::dtype
+      flat_get(types::broadcast<T, B> const &e, long i);
+      template <class Op, class... Args, int... I>
+      typename types::numpy_expr<Op, Args...>::dtype
+      flat_get(types::numpy_expr<Op, Args...> const &e, long i,
+               utils::seq<I...>);
+      template <class Op, class... Args>
+      typename types::numpy_expr<Op, Args...>::dtype
+      flat_get(types::numpy_expr<Op, Args...> const &e, long i);
+    }
 #endif
 
     template <class Op, class E, class F, size_t N, size_t D, bool vector_form>
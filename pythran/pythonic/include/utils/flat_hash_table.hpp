@@ -0,0 +1,262 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_FLAT_HASH_TABLE_HPP
+#define PYTHONIC_INCLUDE_UTILS_FLAT_HASH_TABLE_HPP
+
+#include <boost/functional/hash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      /* Control byte of an index slot: either one of the special values
+       * below, or the 7 lowest bits of the hash of the key it refers to.
+       */
+      using ctrl_t = int8_t;
+      static const ctrl_t ctrl_empty = -128;
+      static const ctrl_t ctrl_deleted = -2;
+
+      /* A group of consecutive control bytes, probed at once. Each method
+       * returns a bitmask with one bit per matching byte.
+       */
+      struct probe_group {
+        static const size_t width = 16;
+
+        // bytes equal to ``h2''
+        static unsigned match(ctrl_t const *ctrl, ctrl_t h2);
+        // empty bytes
+        static unsigned match_empty(ctrl_t const *ctrl);
+        // empty or deleted bytes
+        static unsigned match_free(ctrl_t const *ctrl);
+      };
+
+      // index of the lowest bit set in a non null ``mask''
+      unsigned lowest_bit(unsigned mask);
+
+      // index of the highest bit set in a non null ``n''
+      unsigned highest_bit(size_t n);
+
+      template <class Value>
+      struct select_first {
+        using type = typename std::decay<typename Value::first_type>::type;
+        type const &operator()(Value const &v) const;
+      };
+
+      template <class Value>
+      struct select_self {
+        using type = Value;
+        type const &operator()(Value const &v) const;
+      };
+
+      /* Open-addressing hash table, in the spirit of Google's SwissTable.
+       *
+       * The index is an array of slots, each made of a control byte and the
+       * position of an entry. Lookups probe groups of
+       * ``probe_group::width'' control bytes at once (with SSE2 when
+       * available), and only compare keys whose 7 hash bits match.
+       *
+       * Entries are stored densely, in blocks that never move: growing the
+       * table only rebuilds the index, so references to values stay valid
+       * across insertions, as with a node-based container, without paying an
+       * allocation per insertion. Erased entries are recycled. Iteration
+       * walks the entry blocks, so it is cache friendly and its order is
+       * deterministic: insertion order, as long as nothing has been erased.
+       */
+      template <class Value, class KeyOf, class Hash, class Equal>
+      class flat_hash_table
+      {
+      public:
+        using key_type = typename KeyOf::type;
+        using value_type = Value;
+        using reference = Value &;
+        using const_reference = Value const &;
+        using pointer = Value *;
+        using const_pointer = Value const *;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using allocator_type = std::allocator<Value>;
+        using hasher = Hash;
+        using key_equal = Equal;
+
+      private:
+        struct entry {
+          typename std::aligned_storage<sizeof(Value),
+                                        alignof(Value)>::type storage;
+          size_t hash;
+          size_t index; // position of the entry, or ``dead''
+          Value &value();
+          Value const &value() const;
+        };
+        static const size_t dead = -1;
+
+        // index, each slot points to an entry
+        std::unique_ptr<ctrl_t[]> ctrl_;
+        std::unique_ptr<entry *[]> slots_;
+        size_t capacity_; // number of slots, 0 or a power of two
+        size_t used_;     // number of slots that are not empty
+
+        // entries, block ``b'' holds ``first_block << max(b - 1, 0)'' entries
+        static const size_t first_block_log = 3;
+        std::vector<std::unique_ptr<entry[]>> blocks_;
+        size_t nentries_; // entries ever used, dead or alive
+        size_t size_;     // entries alive
+        size_t first_;    // no entry before this one is alive
+        std::vector<size_t> free_;
+
+        static size_t mix(size_t h);
+        static size_t block_of(size_t i);
+        static size_t block_size(size_t b);
+        entry &at(size_t i);
+        entry const &at(size_t i) const;
+
+        // entry of key ``key'', or nullptr
+        entry *find_entry(key_type const &key, size_t h) const;
+        // first free slot on the probe sequence of ``h''
+        size_t free_slot(size_t h) const;
+        size_t new_entry();
+        void rehash(size_t capacity);
+        void grow_if_needed();
+        void destroy();
+
+        template <class... Args>
+        std::pair<entry *, bool> emplace_impl(key_type const &key,
+                                              Args &&... args);
+        // insert a value whose key is not in the table and hashes to ``h''
+        template <class... Args>
+        entry *insert_new(size_t h, Args &&... args);
+
+      public:
+        template <class T, class V>
+        class basic_iterator
+        {
+          T *table_;
+          size_t index_;
+          V *value_; // cached address of the current value
+          friend class flat_hash_table;
+          template <class T_, class V_>
+          friend class basic_iterator;
+
+        public:
+          using iterator_category = std::forward_iterator_tag;
+          using value_type = Value;
+          using difference_type = std::ptrdiff_t;
+          using pointer = V *;
+          using reference = V &;
+
+          basic_iterator();
+          basic_iterator(T *table, size_t index);
+          basic_iterator(T *table, size_t index, V *value);
+          template <class T_, class V_>
+          basic_iterator(basic_iterator<T_, V_> const &other);
+
+          reference operator*() const;
+          pointer operator->() const;
+          basic_iterator &operator++();
+          basic_iterator operator++(int);
+          template <class T_, class V_>
+          bool operator==(basic_iterator<T_, V_> const &other) const;
+          template <class T_, class V_>
+          bool operator!=(basic_iterator<T_, V_> const &other) const;
+        };
+
+        using iterator = basic_iterator<flat_hash_table, Value>;
+        using const_iterator =
+            basic_iterator<flat_hash_table const, Value const>;
+
+        flat_hash_table();
+        // reserve room for ``n'' elements
+        explicit flat_hash_table(size_t n);
+        template <class B, class E>
+        flat_hash_table(B begin, E end);
+        flat_hash_table(std::initializer_list<Value> l);
+        flat_hash_table(flat_hash_table const &other);
+        flat_hash_table(flat_hash_table &&other);
+        flat_hash_table &operator=(flat_hash_table other);
+        ~flat_hash_table();
+
+        void swap(flat_hash_table &other);
+
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+
+        bool empty() const;
+        size_t size() const;
+
+        iterator find(key_type const &key);
+        const_iterator find(key_type const &key) const;
+        size_t count(key_type const &key) const;
+
+        std::pair<iterator, bool> insert(Value const &value);
+        template <class I>
+        void insert(I begin, I end);
+        // construct a value from ``args'' unless ``key'' is already present
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type const &key,
+                                              Args &&... args);
+
+        iterator erase(const_iterator pos);
+        size_t erase(key_type const &key);
+        void clear();
+        void reserve(size_t n);
+      };
+    }
+
+    template <class K, class V, class Hash = boost::hash<K>,
+              class Equal = std::equal_to<K>>
+    class flat_hash_map
+        : public details::flat_hash_table<
+              std::pair<K const, V>,
+              details::select_first<std::pair<K const, V>>, Hash, Equal>
+    {
+      using base_type =
+          details::flat_hash_table<std::pair<K const, V>,
+                                   details::select_first<std::pair<K const, V>>,
+                                   Hash, Equal>;
+
+    public:
+      using mapped_type = V;
+      using base_type::base_type;
+
+      V &operator[](K const &key);
+    };
+
+    template <class T, class Hash = boost::hash<T>,
+              class Equal = std::equal_to<T>>
+    class flat_hash_set
+        : public details::flat_hash_table<T, details::select_self<T>, Hash,
+                                          Equal>
+    {
+      using base_type =
+          details::flat_hash_table<T, details::select_self<T>, Hash, Equal>;
+
+    public:
+      // as for std::set, elements cannot be modified through iterators
+      using iterator = typename base_type::const_iterator;
+      using base_type::base_type;
+
+      iterator begin() const;
+      iterator end() const;
+      iterator find(T const &key) const;
+    };
+  }
+}
+
+#endif
@@ -24,6 +24,9 @@ namespace pythonic
     template <class A>
     class numpy_texpr_2;
 
+    template <class T, size_t N>
+    struct numpy_sexpr;
+
     template <class O, class... Args>
     class numpy_expr;
 
@@ -89,6 +92,11 @@ namespace pythonic
       static constexpr bool value = true;
     };
 
+    template <class T, size_t N>
+    struct is_array<numpy_sexpr<T, N>> {
+      static constexpr bool value = true;
+    };
+
     template <class O, class... Args>
     struct is_array<numpy_expr<O, Args...>> {
       static constexpr bool value = true;
@@ -0,0 +1,86 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_PHILOX_HPP
+#define PYTHONIC_INCLUDE_UTILS_PHILOX_HPP
+
+#include <atomic>
+#include <cstdint>
+
+/* Counter-based random streams for the random and numpy.random modules.
+ *
+ * Philox4x32-10 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2,
+ * 3", SC'11) turns a 128 bits counter into 128 random bits under a 64 bits
+ * key, the seed. Each thread draws scalars from its own stream, and array
+ * fills are cut in blocks drawn from their own streams, so that they can be
+ * filled in parallel with a result that does not depend on the number of
+ * threads.
+ */
+
+// number of elements drawn from the same stream in array fills
+#ifndef PYTHRAN_RANDOM_BLOCK
+#define PYTHRAN_RANDOM_BLOCK 4096
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    class philox4x32
+    {
+      uint32_t key[2];
+      uint32_t counter[4]; // position in the stream, then stream id
+      uint32_t output[4];
+      unsigned index;
+
+    public:
+      using result_type = uint32_t;
+
+      static constexpr result_type min()
+      {
+        return 0;
+      }
+      static constexpr result_type max()
+      {
+        return 0xFFFFFFFF;
+      }
+
+      // the stream starts at the ``position''th block of 4 values
+      philox4x32(uint64_t seed = 0, uint64_t stream = 0,
+                 uint64_t position = 0);
+
+      result_type operator()();
+    };
+
+    /* Seed of the streams of a module, along with the number of times it
+     * was set, so that the threads notice a new seed.
+     */
+    struct random_state {
+      std::atomic<uint64_t> seed;
+      std::atomic<unsigned long> epoch;
+
+      random_state();
+      void reseed(uint64_t value);
+    };
+
+    // streams of a module, for the calling thread
+    struct thread_random {
+      unsigned long epoch;
+      uint64_t seed;
+      uint64_t nb_fills;
+      philox4x32 generator;
+
+      thread_random();
+      void sync(random_state const &state);
+    };
+
+    /* Set the ``size'' elements from ``first'' to ``draw(generator)'',
+     * drawn from a new set of streams of ``local''. ``draw'' is copied for
+     * each block, so its state does not cross blocks.
+     */
+    template <class T, class Draw>
+    void random_fill(thread_random &local, T *first, long size,
+                     Draw const &draw);
+  }
+}
+
+#endif
@@ -4,7 +4,7 @@
 #include <memory>
 #include <utility>
 #include <unordered_map>
-#ifdef _OPENMP
+#if defined(_OPENMP) || defined(PYTHRAN_NOGIL)
 #include <atomic>
 #endif
 #ifdef ENABLE_PYTHON_MODULE
@@ -19,7 +19,8 @@ namespace pythonic
   using extern_type = void *;
 #endif
 
-#ifdef _OPENMP
+// functions running without the GIL may share objects with other threads
+#if defined(_OPENMP) || defined(PYTHRAN_NOGIL)
   using atomic_size_t = std::atomic_size_t;
 #else
   using atomic_size_t = size_t;
@@ -86,6 +87,9 @@ namespace pythonic
 
       bool operator!=(shared_ref<T> const &other) const noexcept;
 
+      // True if no other shared_ref points to the same memory
+      bool unique() const noexcept;
+
       // Save pointer to the external object to decref once we doesn't
       // use it anymore
       void external(extern_type obj_ptr);
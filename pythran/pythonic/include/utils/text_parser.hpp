@@ -0,0 +1,45 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_TEXT_PARSER_HPP
+#define PYTHONIC_INCLUDE_UTILS_TEXT_PARSER_HPP
+
+#include <vector>
+
+/* Conversion of numeric text to numbers, for numpy.fromstring and
+ * numpy.loadtxt.
+ *
+ * Numbers are parsed without going through the C locale machinery. Large
+ * inputs are cut in chunks at separator boundaries, and the chunks are
+ * parsed in parallel when OpenMP is enabled.
+ */
+
+// minimal size of a chunk, in bytes
+#ifndef PYTHRAN_PARSE_CHUNK_SIZE
+#define PYTHRAN_PARSE_CHUNK_SIZE (1 << 20)
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    bool is_space(char c);
+
+    char const *skip_spaces(char const *first, char const *last);
+
+    /* Parse the number at the beginning of [first, last) into ``value''.
+     * Returns the end of the number, or ``first'' if there is none.
+     */
+    template <class T>
+    char const *parse_number(char const *first, char const *last, T &value);
+
+    /* Cut [first, last) in chunks of about PYTHRAN_PARSE_CHUNK_SIZE bytes,
+     * each ending right after a character matching ``is_boundary'', and
+     * return the results of ``parse(chunk_first, chunk_last)'' in order.
+     */
+    template <class R, class Pred, class Parse>
+    std::vector<R> parse_chunks(char const *first, char const *last,
+                                Pred const &is_boundary, Parse const &parse);
+  }
+}
+
+#endif
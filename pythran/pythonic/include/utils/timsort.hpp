@@ -0,0 +1,73 @@
+#ifndef PYTHONIC_INCLUDE_UTILS_TIMSORT_HPP
+#define PYTHONIC_INCLUDE_UTILS_TIMSORT_HPP
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/* Stable adaptive merge sort, after the one of CPython's ``list.sort''.
+ *
+ * The input is cut into runs, the maximal ascending or strictly descending
+ * (and then reversed) sequences, extended to at least ``minrun'' elements by
+ * binary insertion. Runs are merged as they are found, following the stack
+ * invariants of CPython, so an already sorted input costs n - 1 comparisons.
+ * Merges switch to galloping, an exponential then binary search, when one
+ * run keeps winning, which is what makes partially sorted inputs cheap.
+ *
+ * Large inputs are cut in one slice per thread, sorted in parallel, then
+ * merged in parallel by pairs, each merge being split at ranks that
+ * preserve stability.
+ */
+
+// minimal number of elements to sort in parallel
+#ifndef PYTHRAN_PARALLEL_SORT_THRESHOLD
+#define PYTHRAN_PARALLEL_SORT_THRESHOLD (1L << 16)
+#endif
+
+// number of consecutive wins from which a merge gallops
+#ifndef PYTHRAN_TIMSORT_MIN_GALLOP
+#define PYTHRAN_TIMSORT_MIN_GALLOP 7
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      template <class It, class Compare>
+      class timsort_state
+      {
+        using value_type = typename std::iterator_traits<It>::value_type;
+
+        struct run {
+          It base;
+          long size;
+        };
+
+        Compare comp;
+        long min_gallop;
+        std::vector<value_type> buffer;
+        std::vector<run> runs;
+
+        void merge_collapse();
+        void merge_force_collapse();
+        void merge_at(long i);
+
+      public:
+        timsort_state(Compare const &comp);
+        void sort(It first, It last);
+      };
+    }
+
+    /* Stable sort of [first, last) according to the strict weak ordering
+     * ``comp'', in parallel for large inputs when OpenMP is enabled.
+     */
+    template <class It, class Compare>
+    void timsort(It first, It last, Compare comp);
+  }
+}
+
+#endif
@@ -3,8 +3,10 @@
 
 #include "pythonic/include/itertools/combinations.hpp"
 
+#include "pythonic/itertools/common.hpp"
 #include "pythonic/types/list.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/shared_ref.hpp"
 
 #include <numeric>
 
@@ -16,47 +18,66 @@ namespace pythonic
     namespace details
     {
       template <class T>
-      template <class Iter>
-      combination_iterator<T>::combination_iterator(Iter &&pool, long r)
-          : pool(pool.begin(), pool.end()), indices(r), r(r),
-            stopped(r > long(this->pool.size()))
+      combination_iterator<T>::combination_iterator(
+          utils::shared_ref<std::vector<typename T::value_type>> const &pool,
+          long r, long position)
+          : pool(pool), indices(std::max(r, 0L)), r(r), position(position),
+            result(indices.size())
       {
         assert(r >= 0 and "r must be non-negative");
-        if (not stopped) {
-          std::iota(indices.begin(), indices.end(), 0);
-          result = types::list<typename T::value_type>(this->pool.begin(),
-                                                       this->pool.begin() + r);
+        unrank();
+      }
+
+      /* Sets the indices of the combination of rank ``position'': each
+       * index is the first one such that the combinations starting with
+       * it have a rank larger than ``position''
+       */
+      template <class T>
+      void combination_iterator<T>::unrank()
+      {
+        long const n = pool->size();
+        if (position < 0 or position >= binomial(n, r))
+          return;
+        long rank = position;
+        for (long i = 0, x = 0; i < r; ++i, ++x) {
+          for (long count; rank >= (count = binomial(n - x - 1, r - i - 1));
+               ++x)
+            rank -= count;
+          indices[i] = x;
         }
+        update_result();
       }
 
       template <class T>
-      combination_iterator<T>::combination_iterator(bool)
-          : stopped(true)
+      void combination_iterator<T>::update_result()
       {
+        // the previous value escaped the loop, leave it untouched
+        if (not result.unique() or result.size() != r)
+          result = types::list<typename T::value_type>(r);
+        for (long i = 0; i < r; ++i)
+          result.fast(i) = (*pool)[indices[i]];
       }
 
       template <class T>
-      types::list<typename T::value_type> combination_iterator<T>::
-      operator*() const
+      types::list<typename T::value_type> &combination_iterator<T>::
+      operator*()
       {
-        assert(not stopped && "not stopped");
-        return {result.begin(), result.end()};
+        return result;
       }
 
       template <class T>
       combination_iterator<T> &combination_iterator<T>::operator++()
       {
+        ++position;
         /* Scan indices right-to-left until finding one that is not
            at its maximum (i + n - r). */
-        long i, n = pool.size();
+        long i, n = pool->size();
         for (i = r - 1; i >= 0 && indices[i] == i + n - r; i--)
           ;
 
         /* If i is negative, then the indices are all at
            their maximum value and we're done. */
-        if (i < 0)
-          stopped = true;
-        else {
+        if (i >= 0) {
           /* Increment the current index which we know is not at its
              maximum.  Then move back to the right setting each index
              to its lowest possible value (one higher than the index
@@ -64,43 +85,82 @@ namespace pythonic
           indices[i]++;
           for (long j = i + 1; j < r; j++)
             indices[j] = indices[j - 1] + 1;
-
-          /* Update the result tuple for the new indices
-             starting with i, the leftmost index that changed */
-          for (; i < r; i++) {
-            result[i] = pool[indices[i]];
-          }
+          update_result();
         }
         return *this;
       }
 
+      template <class T>
+      combination_iterator<T> &combination_iterator<T>::operator--()
+      {
+        return *this -= 1;
+      }
+
+      template <class T>
+      combination_iterator<T> &combination_iterator<T>::operator+=(long n)
+      {
+        position += n;
+        unrank();
+        return *this;
+      }
+
+      template <class T>
+      combination_iterator<T> &combination_iterator<T>::operator-=(long n)
+      {
+        return *this += -n;
+      }
+
+      template <class T>
+      combination_iterator<T> combination_iterator<T>::
+      operator+(long n) const
+      {
+        return combination_iterator(*this) += n;
+      }
+
+      template <class T>
+      combination_iterator<T> combination_iterator<T>::
+      operator-(long n) const
+      {
+        return combination_iterator(*this) += -n;
+      }
+
+      template <class T>
+      long combination_iterator<T>::
+      operator-(combination_iterator const &other) const
+      {
+        return position - other.position;
+      }
+
       template <class T>
       bool combination_iterator<T>::
       operator!=(combination_iterator const &other) const
       {
-        assert(stopped or other.stopped);
-        return !(*this == other);
+        return position != other.position;
       }
 
       template <class T>
       bool combination_iterator<T>::
       operator==(combination_iterator const &other) const
       {
-        assert(stopped or other.stopped);
-        return other.stopped == stopped;
+        return position == other.position;
       }
 
       template <class T>
       bool combination_iterator<T>::
       operator<(combination_iterator const &other) const
       {
-        return stopped != other.stopped;
+        return position < other.position;
       }
 
       template <class T>
       template <class Iter>
       combination<T>::combination(Iter &&iter, long elts)
-          : iterator(std::forward<Iter>(iter), elts), num_elts(elts)
+          : iterator(utils::shared_ref<std::vector<typename T::value_type>>(
+                         iter.begin(), iter.end()),
+                     elts, 0),
+            num_elts(elts),
+            end_iter(iterator::pool, elts,
+                     binomial(iterator::pool->size(), elts))
       {
       }
 
@@ -117,9 +177,9 @@ namespace pythonic
       }
 
       template <class T>
-      typename combination<T>::iterator combination<T>::end() const
+      typename combination<T>::iterator const &combination<T>::end() const
       {
-        return {true};
+        return end_iter;
       }
     }
 
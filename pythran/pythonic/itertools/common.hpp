@@ -3,4 +3,55 @@
 
 #include "pythonic/include/itertools/common.hpp"
 
+#include <algorithm>
+#include <limits>
+
+namespace pythonic
+{
+
+  namespace itertools
+  {
+
+    namespace details
+    {
+      long binomial(long n, long k)
+      {
+        if (k < 0 or k > n)
+          return 0;
+        k = std::min(k, n - k);
+        long const max = std::numeric_limits<long>::max();
+        long res = 1;
+        // res * (n - i) is divisible by i + 1
+        for (long i = 0; i < k; ++i) {
+          long g = res, d = i + 1;
+          while (d) {
+            long const t = g % d;
+            g = d;
+            d = t;
+          }
+          long const num = (n - i) / ((i + 1) / g);
+          if (res / g > max / num)
+            return max;
+          res = res / g * num;
+        }
+        return res;
+      }
+
+      long arrangements(long n, long k)
+      {
+        if (k < 0 or k > n)
+          return 0;
+        long const max = std::numeric_limits<long>::max();
+        long res = 1;
+        for (long i = n - k + 1; i <= n; ++i) {
+          if (res > max / i)
+            return max;
+          res *= i;
+        }
+        return res;
+      }
+    }
+  }
+}
+
 #endif
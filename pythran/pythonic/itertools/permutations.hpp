@@ -2,11 +2,13 @@
 #define PYTHONIC_ITERTOOLS_PERMUTATIONS_HPP
 
 #include "pythonic/include/itertools/permutations.hpp"
+#include "pythonic/itertools/common.hpp"
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/shared_ref.hpp"
 #include "pythonic/types/list.hpp"
-#include "pythonic/__builtin__/range.hpp"
 
 #include <iterator>
+#include <numeric>
 #include <vector>
 #include <algorithm>
 
@@ -23,81 +25,125 @@ namespace pythonic
 
     template <class T>
     permutations_iterator<T>::permutations_iterator(
-        std::vector<typename T::value_type> const &iter, size_t num_elts,
-        bool end)
-        : pool(iter), curr_permut(__builtin__::range(pool.size())),
-          _size(num_elts), end(end)
+        utils::shared_ref<std::vector<typename T::value_type>> const &pool,
+        long num_elts, long position)
+        : pool(pool), curr_permut(pool->size()), _size(num_elts),
+          position(position), result(std::max(num_elts, 0L))
     {
-      if (num_elts > iter.size()) {
-        end = true;
+      unrank();
+    }
+
+    /* Sets the indices of the permutation of rank ``position'': the i-th
+     * visible index is the d-th unused one, ``d'' being the i-th digit of
+     * ``position'' in the mixed radix (n, n - 1, ... n - _size + 1)
+     */
+    template <class T>
+    void permutations_iterator<T>::unrank()
+    {
+      long const n = pool->size();
+      if (position < 0 or position >= details::arrangements(n, _size))
+        return;
+      std::vector<long> unused(n);
+      std::iota(unused.begin(), unused.end(), 0);
+      long rank = position;
+      for (long i = 0; i < _size; ++i) {
+        long const block = details::arrangements(n - i - 1, _size - i - 1);
+        auto digit = unused.begin() + rank / block;
+        rank %= block;
+        curr_permut[i] = *digit;
+        unused.erase(digit);
       }
+      std::copy(unused.begin(), unused.end(), curr_permut.begin() + _size);
+      update_result();
     }
 
     template <class T>
-    types::list<typename T::value_type> permutations_iterator<T>::
-    operator*() const
+    void permutations_iterator<T>::update_result()
     {
-      types::list<typename T::value_type> res(_size);
-      for (size_t i = 0; i < _size; i++)
-        res[i] =
-            pool[curr_permut[i]]; // Ok because types::list is indeed a vector
-      return res;
+      // the previous value escaped the loop, leave it untouched
+      if (not result.unique() or result.size() != _size)
+        result = types::list<typename T::value_type>(_size);
+      for (long i = 0; i < _size; i++)
+        result.fast(i) = (*pool)[curr_permut[i]];
+    }
+
+    template <class T>
+    types::list<typename T::value_type> &permutations_iterator<T>::
+    operator*()
+    {
+      return result;
     }
 
     template <class T>
     permutations_iterator<T> &permutations_iterator<T>::operator++()
     {
-      if (_size != pool.size()) {
-        // Slow path, the iterator is a "view" of a prefix smaller
-        // than the the pool size
-        // FIXME a better implementation would be to avoid
-        // std::next_permutation, but only in the slow path
-        types::list<int> prev_permut(curr_permut.begin(),
-                                     curr_permut.begin() + _size);
-        types::list<int> new_permut;
-        while ((end = std::next_permutation(curr_permut.begin(),
-                                            curr_permut.end()))) {
-          // Check if the prefix of the new permutation is
-          // different of the previous one
-          types::list<int> new_permut(curr_permut.begin(),
-                                      curr_permut.begin() + _size);
-          if (!(prev_permut == new_permut))
-            break;
-        }
-      } else
-        end = std::next_permutation(curr_permut.begin(), curr_permut.end());
+      ++position;
+      std::reverse(curr_permut.begin() + _size, curr_permut.end());
+      if (std::next_permutation(curr_permut.begin(), curr_permut.end()))
+        update_result();
+      return *this;
+    }
+
+    template <class T>
+    permutations_iterator<T> &permutations_iterator<T>::operator--()
+    {
+      return *this -= 1;
+    }
+
+    template <class T>
+    permutations_iterator<T> &permutations_iterator<T>::operator+=(long n)
+    {
+      position += n;
+      unrank();
       return *this;
     }
 
+    template <class T>
+    permutations_iterator<T> &permutations_iterator<T>::operator-=(long n)
+    {
+      return *this += -n;
+    }
+
+    template <class T>
+    permutations_iterator<T> permutations_iterator<T>::
+    operator+(long n) const
+    {
+      return permutations_iterator(*this) += n;
+    }
+
+    template <class T>
+    permutations_iterator<T> permutations_iterator<T>::
+    operator-(long n) const
+    {
+      return permutations_iterator(*this) += -n;
+    }
+
+    template <class T>
+    long permutations_iterator<T>::
+    operator-(permutations_iterator<T> const &other) const
+    {
+      return position - other.position;
+    }
+
     template <class T>
     bool permutations_iterator<T>::
     operator!=(permutations_iterator<T> const &other) const
     {
-      return !(*this == other);
+      return position != other.position;
     }
 
     template <class T>
     bool permutations_iterator<T>::
     operator==(permutations_iterator<T> const &other) const
     {
-      if (other.end != end)
-        return false;
-      return std::equal(curr_permut.begin(), curr_permut.end(),
-                        other.curr_permut.begin());
+      return position == other.position;
     }
 
     template <class T>
     bool permutations_iterator<T>::
     operator<(permutations_iterator<T> const &other) const
     {
-      if (end != other.end)
-        return end > other.end;
-      for (int i = 0; i < pool.size(); i++)
-        if (other.curr_permut[i] < curr_permut[i])
-          return false;
-        else if (other.curr_permut[i] > curr_permut[i])
-          return true;
-      return false;
+      return position < other.position;
     }
 
     template <class T>
@@ -107,9 +153,11 @@ namespace pythonic
 
     template <class T>
     _permutations<T>::_permutations(T iter, int elts)
-        : iterator(
-              std::vector<typename T::value_type>(iter.begin(), iter.end()),
-              elts, true)
+        : iterator(utils::shared_ref<std::vector<typename T::value_type>>(
+                       iter.begin(), iter.end()),
+                   elts, 0),
+          end_iter(iterator::pool, elts,
+                   details::arrangements(iterator::pool->size(), elts))
     {
     }
 
@@ -126,9 +174,9 @@ namespace pythonic
     }
 
     template <class T>
-    typename _permutations<T>::iterator _permutations<T>::end() const
+    typename _permutations<T>::iterator const &_permutations<T>::end() const
     {
-      return iterator(iterator::pool, iterator::_size, false);
+      return end_iter;
     }
 
     template <typename T0>
@@ -6,7 +6,10 @@
 #include "pythonic/itertools/common.hpp"
 #include "pythonic/utils/functor.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
+#include <numeric>
 #include <type_traits>
 
 namespace pythonic
@@ -25,8 +28,12 @@ namespace pythonic
                                                    utils::seq<I...> const &)
           : it_begin(std::get<I>(_iters).begin()...),
             it_end(std::get<I>(_iters).end()...),
-            it(std::get<I>(_iters).begin()...), end(it_begin == it_end)
+            it(std::get<I>(_iters).begin()...), end(false), position(0)
       {
+        // the product is empty as soon as one of the iterables is
+        bool const empty[] = {(std::get<I>(it_begin) == std::get<I>(it_end))...};
+        end = std::find(std::begin(empty), std::end(empty), true) !=
+              std::end(empty);
       }
 
       template <typename... Iters>
@@ -36,7 +43,7 @@ namespace pythonic
                                                    utils::seq<I...> const &)
           : it_begin(std::get<I>(_iters).end()...),
             it_end(std::get<I>(_iters).end()...),
-            it(std::get<I>(_iters).end()...), end(true)
+            it(std::get<I>(_iters).end()...), end(true), position(0)
       {
       }
 
@@ -75,10 +82,68 @@ namespace pythonic
       template <typename... Iters>
       product_iterator<Iters...> &product_iterator<Iters...>::operator++()
       {
+        ++position;
         advance(utils::int_<sizeof...(Iters)-1>{});
         return *this;
       }
 
+      template <typename... Iters>
+      template <int... I>
+      long product_iterator<Iters...>::size(utils::seq<I...> const &) const
+      {
+        long const sizes[] = {
+            long(std::get<I>(it_end) - std::get<I>(it_begin))...};
+        return std::accumulate(std::begin(sizes), std::end(sizes), 1L,
+                               std::multiplies<long>());
+      }
+
+      template <typename... Iters>
+      template <size_t N>
+      void product_iterator<Iters...>::seek(long rank, utils::int_<N>)
+      {
+        long const size = std::get<N>(it_end) - std::get<N>(it_begin);
+        std::get<N>(it) = std::get<N>(it_begin) + rank % size;
+        seek(rank / size, utils::int_<N - 1>());
+      }
+
+      template <typename... Iters>
+      void product_iterator<Iters...>::seek(long rank, utils::int_<0>)
+      {
+        std::get<0>(it) = std::get<0>(it_begin) + rank;
+      }
+
+      template <typename... Iters>
+      product_iterator<Iters...> &product_iterator<Iters...>::
+      operator+=(long n)
+      {
+        position += n;
+        end = position >= size(typename utils::gens<sizeof...(Iters)>::type{});
+        if (not end)
+          seek(position, utils::int_<sizeof...(Iters)-1>{});
+        return *this;
+      }
+
+      template <typename... Iters>
+      product_iterator<Iters...> product_iterator<Iters...>::
+      operator+(long n) const
+      {
+        return product_iterator(*this) += n;
+      }
+
+      template <typename... Iters>
+      long product_iterator<Iters...>::
+      operator-(product_iterator<Iters...> const &other) const
+      {
+        // an iterator past the end stands for the size of the product, which
+        // only the other one knows
+        auto const seq = typename utils::gens<sizeof...(Iters)>::type{};
+        if (end)
+          return other.end ? 0 : other.size(seq) - other.position;
+        if (other.end)
+          return position - size(seq);
+        return position - other.position;
+      }
+
       template <typename... Iters>
       bool product_iterator<Iters...>::
       operator==(product_iterator<Iters...> const &other) const
@@ -5,30 +5,56 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/sort.hpp"
+
+#include <numeric>
 
 namespace pythonic
 {
 
   namespace numpy
   {
+    namespace details
+    {
+      /* Sorts a gathered lane and writes the resulting permutation in the
+       * matching lane of ``indices''
+       */
+      template <class T>
+      struct argsort_kernel {
+        long *indices;
+        long size;
+        long stride;
+        sorter<T> s;
+        std::vector<long> order;
+
+        void operator()(T *first, T *last, long lane)
+        {
+          order.resize(size);
+          s.argsort(first, last, order.data());
+          long *out = indices + (lane / stride) * size * stride + lane % stride;
+          for (long k = 0; k < size; ++k)
+            out[k * stride] = order[k];
+        }
+      };
+    }
+
     template <class T, size_t N>
-    types::ndarray<long, N> argsort(types::ndarray<T, N> const &a)
+    types::ndarray<long, N> argsort(types::ndarray<T, N> const &a, long axis)
     {
-      size_t last_axis = a.shape()[N - 1];
-      size_t n = a.flat_size();
-      types::ndarray<long, N> indices(a.shape(), __builtin__::None);
-      for (long j = 0, *iter_indices = indices.buffer,
-                *end_indices = indices.buffer + n;
-           iter_indices != end_indices;
-           iter_indices += last_axis, j += last_axis) {
-        // fill with the original indices
-        std::iota(iter_indices, iter_indices + last_axis, 0L);
-        // sort the index using the value from a
-        std::sort(iter_indices, iter_indices + last_axis,
-                  [&a, j](long i1, long i2) {
-                    return *(a.fbegin() + j + i1) < *(a.fbegin() + j + i2);
-                  });
-      }
+      while (axis < 0)
+        axis += N;
+      axis = axis % N;
+      auto &&shape = a.shape();
+      long const stride = std::accumulate(shape.begin() + axis + 1,
+                                          shape.end(), 1L,
+                                          std::multiplies<long>());
+      types::ndarray<long, N> indices(shape, __builtin__::None);
+      // the engine sorts the values along with their indices, so work on a
+      // copy
+      types::ndarray<T, N> values = a.copy();
+      details::for_each_lane(
+          values, axis,
+          details::argsort_kernel<T>{indices.buffer, shape[axis], stride});
       return indices;
     }
 
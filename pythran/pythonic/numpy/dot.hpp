@@ -7,7 +7,9 @@
 #include "pythonic/numpy/sum.hpp"
 #include "pythonic/types/numpy_expr.hpp"
 #include "pythonic/types/traits.hpp"
+#include "pythonic/utils/blocked_gemm.hpp"
 
+#include <algorithm>
 #include <cblas.h>
 
 namespace pythonic
@@ -35,252 +37,327 @@ namespace pythonic
       return sum(types::numpy_expr<operator_::functor::mul, E, F>(e, f));
     }
 
-/// Matrice / Vector multiplication
+namespace details
+    {
+      template <size_t N>
+      types::array<long, N> contiguous_strides(types::array<long, N> const &shape)
+      {
+        types::array<long, N> strides;
+        long stride = 1;
+        for (long i = N - 1; i >= 0; --i) {
+          strides[i] = stride;
+          stride *= shape[i];
+        }
+        return strides;
+      }
 
-#define MV_DEF(T, L)                                                           \
-  void mv(int m, int n, T *A, T *B, T *C)                                      \
-  {                                                                            \
-    cblas_##L##gemv(CblasRowMajor, CblasNoTrans, n, m, 1, A, m, B, 1, 0, C,    \
-                    1);                                                        \
-  }
+      template <class E, class Enable>
+      strided_operand<E, Enable>::strided_operand(E const &expr)
+          : values(expr), data(values.buffer),
+            strides(contiguous_strides(values.shape()))
+      {
+      }
 
-    MV_DEF(double, d)
-    MV_DEF(float, s)
+      template <class T, size_t N>
+      strided_operand<types::ndarray<T, N>>::strided_operand(
+          types::ndarray<T, N> const &expr)
+          : data(expr.buffer), strides(contiguous_strides(expr.shape()))
+      {
+      }
 
-#undef MV_DEF
-#define MV_DEF(T, L)                                                           \
-  void mv(int m, int n, T *A, T *B, T *C)                                      \
-  {                                                                            \
-    T alpha = 1, beta = 0;                                                     \
-    cblas_##L##gemv(CblasRowMajor, CblasNoTrans, n, m, &alpha, A, m, B, 1,     \
-                    &beta, C, 1);                                              \
-  }
-    MV_DEF(std::complex<float>, c)
-    MV_DEF(std::complex<double>, z)
-#undef MV_DEF
+      template <class T>
+      strided_operand<types::numpy_texpr<types::ndarray<T, 2>>>::
+          strided_operand(types::numpy_texpr<types::ndarray<T, 2>> const &expr)
+          : data(expr.arg.buffer), strides{{1, expr.arg.shape()[1]}}
+      {
+      }
 
-    template <class E>
-    typename std::enable_if<is_blas_type<E>::value, types::ndarray<E, 1>>::type
-        dot(types::ndarray<E, 2> const &f, types::ndarray<E, 1> const &e)
-    {
-      types::ndarray<E, 1> out(types::array<long, 1>{{f.shape()[0]}},
-                               __builtin__::None);
-      const int m = f.shape()[1], n = f.shape()[0];
-      mv(m, n, f.buffer, e.buffer, out.buffer);
-      return out;
-    }
+      template <class Arg>
+      strided_operand<types::numpy_iexpr<Arg>,
+                      typename std::enable_if<types::is_ndarray<
+                          typename std::decay<Arg>::type>::value>::type>::
+          strided_operand(types::numpy_iexpr<Arg> const &expr)
+          : data(expr.buffer), strides(contiguous_strides(expr.shape()))
+      {
+      }
+
+      template <class Arg, class... S>
+      strided_operand<
+          types::numpy_gexpr<Arg, S...>,
+          typename std::enable_if<
+              types::is_ndarray<typename std::decay<Arg>::type>::value and
+              types::count_long<S...>::value == 0>::type>::
+          strided_operand(types::numpy_gexpr<Arg, S...> const &expr)
+          : data(expr.buffer)
+      {
+        // the axes after the last slice are not sliced
+        auto const arg_strides = contiguous_strides(expr.arg.shape());
+        for (size_t i = 0; i < strides.size(); ++i) {
+          if (i < sizeof...(S)) {
+            data += expr.lower[i] * arg_strides[i];
+            strides[i] = expr.step[i] * arg_strides[i];
+          } else
+            strides[i] = arg_strides[i];
+        }
+      }
 
-// The trick is to not transpose the matrix so that MV become VM
-#define VM_DEF(T, L)                                                           \
-  void vm(int m, int n, T *A, T *B, T *C)                                      \
+/* BLAS reads row major matrices with a unit stride along the columns,
+ * or along the rows when told to transpose them.
+ */
+#define MM_DEF(T, L)                                                           \
+  void blas_gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,  \
+                 T const *A, int lda, T const *B, int ldb, T *C, int ldc)      \
+  {                                                                            \
+    cblas_##L##gemm(CblasRowMajor, ta, tb, m, n, k, 1, A, lda, B, ldb, 0, C,   \
+                    ldc);                                                      \
+  }                                                                            \
+  void blas_gemv(CBLAS_TRANSPOSE ta, int m, int n, T const *A, int lda,        \
+                 T const *x, int incx, T *y)                                   \
   {                                                                            \
-    cblas_##L##gemv(CblasRowMajor, CblasTrans, n, m, 1, A, m, B, 1, 0, C, 1);  \
+    cblas_##L##gemv(CblasRowMajor, ta, m, n, 1, A, lda, x, incx, 0, y, 1);     \
   }
-
-    VM_DEF(double, d)
-    VM_DEF(float, s)
-
-#undef VM_DEF
-#define VM_DEF(T, L)                                                           \
-  void vm(int m, int n, T *A, T *B, T *C)                                      \
+      MM_DEF(double, d)
+      MM_DEF(float, s)
+#undef MM_DEF
+#define MM_DEF(T, L)                                                           \
+  void blas_gemm(CBLAS_TRANSPOSE ta, CBLAS_TRANSPOSE tb, int m, int n, int k,  \
+                 T const *A, int lda, T const *B, int ldb, T *C, int ldc)      \
+  {                                                                            \
+    T alpha = 1, beta = 0;                                                     \
+    cblas_##L##gemm(CblasRowMajor, ta, tb, m, n, k, &alpha, A, lda, B, ldb,    \
+                    &beta, C, ldc);                                            \
+  }                                                                            \
+  void blas_gemv(CBLAS_TRANSPOSE ta, int m, int n, T const *A, int lda,        \
+                 T const *x, int incx, T *y)                                   \
   {                                                                            \
     T alpha = 1, beta = 0;                                                     \
-    cblas_##L##gemv(CblasRowMajor, CblasTrans, n, m, &alpha, A, m, B, 1,       \
-                    &beta, C, 1);                                              \
+    cblas_##L##gemv(CblasRowMajor, ta, m, n, &alpha, A, lda, x, incx, &beta,   \
+                    y, 1);                                                     \
   }
-    VM_DEF(std::complex<float>, c)
-    VM_DEF(std::complex<double>, z)
-#undef VM_DEF
+      MM_DEF(std::complex<float>, c)
+      MM_DEF(std::complex<double>, z)
+#undef MM_DEF
 
-    template <class E>
-    typename std::enable_if<is_blas_type<E>::value, types::ndarray<E, 1>>::type
-        dot(types::ndarray<E, 1> const &e, types::ndarray<E, 2> const &f)
-    {
-      types::ndarray<E, 1> out(types::array<long, 1>{{f.shape()[1]}},
-                               __builtin__::None);
-      const int m = f.shape()[1], n = f.shape()[0];
-      vm(m, n, f.buffer, e.buffer, out.buffer);
-      return out;
-    }
+      // how BLAS reads the ``rows'' x ``cols'' matrix, if it can
+      bool blas_layout(long rs, long cs, long rows, long cols,
+                       CBLAS_TRANSPOSE &trans, int &ld)
+      {
+        if (cs == 1 and rs >= std::max(cols, 1L)) {
+          trans = CblasNoTrans;
+          ld = rs;
+          return true;
+        }
+        if (rs == 1 and cs >= std::max(rows, 1L)) {
+          trans = CblasTrans;
+          ld = cs;
+          return true;
+        }
+        return false;
+      }
 
-    // If arguments could be use with blas, we evaluate them as we need pointer
-    // on array for blas
-    template <class E, class F>
-    typename std::enable_if<
-        types::is_numexpr_arg<E>::value and
-            types::is_numexpr_arg<F>::value // It is an array_like
-            and
-            not(types::is_ndarray<E>::value and types::is_ndarray<F>::value) and
-            is_blas_type<typename E::dtype>::value and
-            is_blas_type<typename F::dtype>::value // With dtype compatible with
-                                                   // blas
-            and
-            E::value == 2 and F::value == 1, // And it is matrix / vect
-        types::ndarray<
-            typename __combined<typename E::dtype, typename F::dtype>::type,
-            1>>::type
-    dot(E const &e, F const &f)
-    {
-      types::ndarray<
-          typename __combined<typename E::dtype, typename F::dtype>::type, 2>
-          e_ = e;
-      types::ndarray<
-          typename __combined<typename E::dtype, typename F::dtype>::type, 1>
-          f_ = f;
-      return dot(e_, f_);
-    }
+      template <class A, class B, class C>
+      void matrix_product(long m, long n, long k, A const *a, long a_rs,
+                          long a_cs, B const *b, long b_rs, long b_cs, C *c,
+                          long c_stride)
+      {
+        utils::gemm(m, n, k, a, a_rs, a_cs, b, b_rs, b_cs, c, c_stride);
+      }
 
-    // If arguments could be use with blas, we evaluate them as we need pointer
-    // on array for blas
-    template <class E, class F>
-    typename std::enable_if<
-        types::is_numexpr_arg<E>::value and
-            types::is_numexpr_arg<F>::value // It is an array_like
-            and
-            not(types::is_ndarray<E>::value and types::is_ndarray<F>::value) and
-            is_blas_type<typename E::dtype>::value and
-            is_blas_type<typename F::dtype>::value // With dtype compatible with
-                                                   // blas
-            and
-            E::value == 1 and F::value == 2, // And it is vect / matrix
-        types::ndarray<
-            typename __combined<typename E::dtype, typename F::dtype>::type,
-            1>>::type
-    dot(E const &e, F const &f)
-    {
-      types::ndarray<
-          typename __combined<typename E::dtype, typename F::dtype>::type, 1>
-          e_ = e;
-      types::ndarray<
-          typename __combined<typename E::dtype, typename F::dtype>::type, 2>
-          f_ = f;
-      return dot(e_, f_);
+      template <class T>
+      typename std::enable_if<is_blas_type<T>::value>::type
+      matrix_product(long m, long n, long k, T const *a, long a_rs, long a_cs,
+                     T const *b, long b_rs, long b_cs, T *c, long c_stride)
+      {
+        CBLAS_TRANSPOSE ta, tb;
+        int lda, ldb;
+        if (m and n and k and blas_layout(a_rs, a_cs, m, k, ta, lda) and
+            blas_layout(b_rs, b_cs, k, n, tb, ldb))
+          blas_gemm(ta, tb, m, n, k, a, lda, b, ldb, c, c_stride);
+        else
+          utils::gemm(m, n, k, a, a_rs, a_cs, b, b_rs, b_cs, c, c_stride);
+      }
+
+      template <class A, class X, class Y>
+      void matrix_vector(long m, long n, A const *a, long a_rs, long a_cs,
+                         X const *x, long x_stride, Y *y)
+      {
+        utils::gemv(m, n, a, a_rs, a_cs, x, x_stride, y);
+      }
+
+      template <class T>
+      typename std::enable_if<is_blas_type<T>::value>::type
+      matrix_vector(long m, long n, T const *a, long a_rs, long a_cs,
+                    T const *x, long x_stride, T *y)
+      {
+        CBLAS_TRANSPOSE ta;
+        int lda;
+        if (m and n and x_stride > 0 and
+            blas_layout(a_rs, a_cs, m, n, ta, lda)) {
+          if (ta == CblasNoTrans)
+            blas_gemv(ta, m, n, a, lda, x, x_stride, y);
+          else
+            blas_gemv(ta, n, m, a, lda, x, x_stride, y);
+        } else
+          utils::gemv(m, n, a, a_rs, a_cs, x, x_stride, y);
+      }
+
+      template <class A, class B, class C, size_t N>
+      void batched_product(types::array<long, N> const &shape, long k,
+                           A const *a, types::array<long, N> const &a_strides,
+                           B const *b, types::array<long, N> const &b_strides,
+                           C *c)
+      {
+        long const m = shape[N - 2], n = shape[N - 1];
+        long nb_batches = 1;
+        for (size_t i = 0; i < N - 2; ++i)
+          nb_batches *= shape[i];
+        // small products run in parallel over the batches, large ones over
+        // their tiles
+        double const work = double(m) * n * k;
+#ifdef _OPENMP
+#pragma omp parallel for if (nb_batches > 1 and                               \
+                             work < PYTHRAN_GEMM_PARALLEL_THRESHOLD and       \
+                             work * nb_batches >=                             \
+                                 PYTHRAN_GEMM_PARALLEL_THRESHOLD)
+#endif
+        for (long batch = 0; batch < nb_batches; ++batch) {
+          A const *a_batch = a;
+          B const *b_batch = b;
+          for (long i = N - 3, rem = batch; i >= 0; --i) {
+            long const index = rem % shape[i];
+            rem /= shape[i];
+            a_batch += index * a_strides[i];
+            b_batch += index * b_strides[i];
+          }
+          C *c_batch = c + batch * m * n;
+          if (n == 1)
+            matrix_vector(m, k, a_batch, a_strides[N - 2], a_strides[N - 1],
+                          b_batch, b_strides[N - 2], c_batch);
+          else
+            matrix_product(m, n, k, a_batch, a_strides[N - 2],
+                           a_strides[N - 1], b_batch, b_strides[N - 2],
+                           b_strides[N - 1], c_batch, n);
+        }
+      }
     }
 
-    // If one of the arg doesn't have a "blas compatible type", we use a slow
-    // matrix vector multiplication.
+    /// Matrix / Vector multiplication
+
     template <class E, class F>
     typename std::enable_if<
-        (not is_blas_type<typename E::dtype>::value or
-         not is_blas_type<typename F::dtype>::value) and
-            E::value == 1 and F::value == 2, // And it is vect / matrix
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and E::value == 2 and
+            F::value == 1, // And it is matrix / vect
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
             1>>::type
     dot(E const &e, F const &f)
     {
+      details::strided_operand<E> a(e);
+      details::strided_operand<F> x(f);
       types::ndarray<
           typename __combined<typename E::dtype, typename F::dtype>::type, 1>
-      out(types::array<long, 1>{{f.shape()[1]}}, 0);
-      for (long i = 0; i < out.shape()[0]; i++)
-        for (long j = 0; j < f.shape()[0]; j++)
-          out[i] += e[j] * f[types::array<long, 2>{{j, i}}];
+      out(types::array<long, 1>{{e.shape()[0]}}, __builtin__::None);
+      details::matrix_vector(e.shape()[0], e.shape()[1], a.data, a.strides[0],
+                             a.strides[1], x.data, x.strides[0], out.buffer);
       return out;
     }
 
-    // If one of the arg doesn't have a "blas compatible type", we use a slow
-    // matrix vector multiplication.
+    // The trick is to transpose the matrix so that VM becomes MV
     template <class E, class F>
     typename std::enable_if<
-        (not is_blas_type<typename E::dtype>::value or
-         not is_blas_type<typename F::dtype>::value) and
-            E::value == 2 and F::value == 1, // And it is vect / matrix
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and E::value == 1 and
+            F::value == 2, // And it is vect / matrix
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
             1>>::type
     dot(E const &e, F const &f)
     {
+      details::strided_operand<E> x(e);
+      details::strided_operand<F> a(f);
       types::ndarray<
           typename __combined<typename E::dtype, typename F::dtype>::type, 1>
-      out(types::array<long, 1>{{e.shape()[0]}}, 0);
-      for (long i = 0; i < out.shape()[0]; i++)
-        for (long j = 0; j < f.shape()[0]; j++)
-          out[i] += e[types::array<long, 2>{{i, j}}] * f[j];
+      out(types::array<long, 1>{{f.shape()[1]}}, __builtin__::None);
+      details::matrix_vector(f.shape()[1], f.shape()[0], a.data, a.strides[1],
+                             a.strides[0], x.data, x.strides[0], out.buffer);
       return out;
     }
 
-/// Matrix / Matrix multiplication
+    /// Matrix / Matrix multiplication
 
-#define MM_DEF(T, L)                                                           \
-  void mm(int m, int n, int k, T *A, T *B, T *C)                               \
-  {                                                                            \
-    cblas_##L##gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1, A,  \
-                    k, B, n, 0, C, n);                                         \
-  }
-    MM_DEF(double, d)
-    MM_DEF(float, s)
-#undef MM_DEF
-#define MM_DEF(T, L)                                                           \
-  void mm(int m, int n, int k, T *A, T *B, T *C)                               \
-  {                                                                            \
-    T alpha = 1, beta = 0;                                                     \
-    cblas_##L##gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,        \
-                    &alpha, A, k, B, n, &beta, C, n);                          \
-  }
-    MM_DEF(std::complex<float>, c)
-    MM_DEF(std::complex<double>, z)
-#undef MM_DEF
-
-    template <class E>
-    typename std::enable_if<is_blas_type<E>::value, types::ndarray<E, 2>>::type
-        dot(types::ndarray<E, 2> const &a, types::ndarray<E, 2> const &b)
-    {
-      int m = b.shape()[1], n = a.shape()[0], k = b.shape()[0];
-
-      types::ndarray<E, 2> out(types::array<long, 2>{{m, n}},
-                               __builtin__::None);
-      mm(m, n, k, a.buffer, b.buffer, out.buffer);
-      return out;
-    }
-
-    // If arguments could be sue with blas, we evaluate them as we need pointer
-    // on array for blas
     template <class E, class F>
     typename std::enable_if<
         types::is_numexpr_arg<E>::value and
-            types::is_numexpr_arg<F>::value // It is an array_like
-            and
-            not(types::is_ndarray<E>::value and types::is_ndarray<F>::value) and
-            is_blas_type<typename E::dtype>::value and
-            is_blas_type<typename F::dtype>::value // With dtype compatible with
-                                                   // blas
-            and
-            E::value == 2 and F::value == 2, // And both are matrix
+            types::is_numexpr_arg<F>::value and E::value == 2 and
+            F::value == 2, // And both are matrix
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
             2>>::type
     dot(E const &e, F const &f)
     {
+      details::strided_operand<E> a(e);
+      details::strided_operand<F> b(f);
+      long const m = e.shape()[0], n = f.shape()[1], k = e.shape()[1];
       types::ndarray<
           typename __combined<typename E::dtype, typename F::dtype>::type, 2>
-          e_ = e;
-      types::ndarray<
-          typename __combined<typename E::dtype, typename F::dtype>::type, 2>
-          f_ = f;
-      return dot(e_, f_);
+      out(types::array<long, 2>{{m, n}}, __builtin__::None);
+      details::matrix_product(m, n, k, a.data, a.strides[0], a.strides[1],
+                              b.data, b.strides[0], b.strides[1], out.buffer,
+                              n);
+      return out;
     }
 
-    // If one of the arg doesn't have a "blas compatible type", we use a slow
-    // matrix multiplication.
+    /// Array / Matrix and Array / Vector multiplication, over the last axis
+    /// of the array
+
     template <class E, class F>
     typename std::enable_if<
-        (not is_blas_type<typename E::dtype>::value or
-         not is_blas_type<typename F::dtype>::value) and
-            E::value == 2 and F::value == 2, // And it is matrix / matrix
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and (E::value > 2) and
+            (F::value == 1 or F::value == 2),
         types::ndarray<
             typename __combined<typename E::dtype, typename F::dtype>::type,
-            2>>::type
+            E::value + F::value - 2>>::type
     dot(E const &e, F const &f)
     {
+      constexpr size_t N = E::value;
+      details::strided_operand<E> a(e);
+      details::strided_operand<F> b(f);
+
+      // the result is the product of each matrix of ``e'' by ``f'', seen as
+      // a matrix of a single column if it is a vector
+      types::array<long, N> shape, b_strides;
+      std::copy(e.shape().begin(), e.shape().end() - 1, shape.begin());
+      shape[N - 1] = F::value == 2 ? f.shape()[F::value - 1] : 1;
+      std::fill(b_strides.begin(), b_strides.end(), 0);
+      b_strides[N - 2] = b.strides[0];
+      b_strides[N - 1] = F::value == 2 ? b.strides[F::value - 1] : 0;
+
+      types::array<long, E::value + F::value - 2> out_shape;
+      std::copy(shape.begin(), shape.begin() + out_shape.size(),
+                out_shape.begin());
       types::ndarray<
-          typename __combined<typename E::dtype, typename F::dtype>::type, 2>
-      out(types::array<long, 2>{{e.shape()[0], f.shape()[1]}}, 0);
-      for (long i = 0; i < out.shape()[0]; i++)
-        for (long j = 0; j < out.shape()[1]; j++)
-          for (long k = 0; k < e.shape()[1]; k++)
-            out[types::array<long, 2>{{i, j}}] +=
-                e[types::array<long, 2>{{i, k}}] *
-                f[types::array<long, 2>{{k, j}}];
+          typename __combined<typename E::dtype, typename F::dtype>::type,
+          E::value + F::value - 2>
+      out(out_shape, __builtin__::None);
+
+      // a single product if the matrices of ``e'' are stacked regularly
+      long rows = shape[N - 2];
+      bool stacked = true;
+      for (size_t i = 0; i < N - 2; ++i) {
+        rows *= shape[i];
+        stacked &= a.strides[i] == a.strides[i + 1] * shape[i + 1];
+      }
+      if (stacked)
+        details::batched_product(
+            types::array<long, 2>{{rows, shape[N - 1]}}, e.shape()[N - 1],
+            a.data, types::array<long, 2>{{a.strides[N - 2], a.strides[N - 1]}},
+            b.data, types::array<long, 2>{{b_strides[N - 2], b_strides[N - 1]}},
+            out.buffer);
+      else
+        details::batched_product(shape, e.shape()[N - 1], a.data, a.strides,
+                                 b.data, b_strides, out.buffer);
       return out;
     }
 
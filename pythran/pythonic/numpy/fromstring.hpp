@@ -4,49 +4,109 @@
 #include "pythonic/include/numpy/fromstring.hpp"
 
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/text_parser.hpp"
 #include "pythonic/types/ndarray.hpp"
-#include "pythonic/types/list.hpp"
+#include "pythonic/types/exceptions.hpp"
+#include "pythonic/__builtin__/None.hpp"
 
-#include <limits>
-#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <vector>
 
 namespace pythonic
 {
 
   namespace numpy
   {
+    namespace details
+    {
+      template <class T>
+      struct fromstring_chunk {
+        std::vector<T> values;
+        bool stopped = false; // on a malformed item, as numpy does
+      };
+    }
+
     template <class dtype>
     types::ndarray<typename dtype::type, 1> fromstring(types::str const &string,
                                                        dtype d, long count,
                                                        types::str const &sep)
     {
+      using T = typename dtype::type;
       if (sep) {
-        types::list<typename dtype::type> res(0);
-        if (count < 0)
-          count = std::numeric_limits<long>::max();
-        else
-          res.reserve(count);
-        size_t current;
-        size_t next = -1;
-        long numsplit = 0;
-        do {
-          current = next + 1;
-          next = string.find_first_of(sep, current);
-          typename dtype::type item;
-          std::istringstream iss(
-              string.substr(current, next - current).get_data());
-          iss >> item;
-          res.push_back(item);
-        } while (next != types::str::npos && ++numsplit < count);
-        return {res};
+        // blanks in the separator match any run of whitespace, so does
+        // the whitespace around it
+        std::string stripped(utils::skip_spaces(sep.begin(), sep.end()),
+                             sep.end());
+        while (not stripped.empty() and utils::is_space(stripped.back()))
+          stripped.pop_back();
+
+        auto parse = [&stripped, count](char const *first, char const *last) {
+          details::fromstring_chunk<T> chunk;
+          first = utils::skip_spaces(first, last);
+          while (first != last and
+                 (count < 0 or long(chunk.values.size()) < count)) {
+            T item;
+            char const *next = utils::parse_number(first, last, item);
+            if (next == first) {
+              chunk.stopped = true;
+              break;
+            }
+            chunk.values.push_back(item);
+            first = utils::skip_spaces(next, last);
+            if (not stripped.empty() and first != last) {
+              if (stripped.compare(0, stripped.size(), first,
+                                   std::min<size_t>(stripped.size(),
+                                                    last - first)) != 0) {
+                chunk.stopped = true;
+                break;
+              }
+              first = utils::skip_spaces(first + stripped.size(), last);
+            }
+          }
+          return chunk;
+        };
+
+        // chunks end after a separator, as long as it cannot be part of a
+        // number; inputs with a known count are small anyway
+        char sep_char = stripped.empty() ? ' ' : stripped[0];
+        bool split = count < 0 and stripped.size() <= 1 and
+                     not std::isalnum(static_cast<unsigned char>(sep_char)) and
+                     not std::strchr("+-.", sep_char);
+        auto is_boundary = [&stripped, split, sep_char](char c) {
+          return split and
+                 (stripped.empty() ? utils::is_space(c) : c == sep_char);
+        };
+
+        char const *first = string.chars();
+        auto chunks = utils::parse_chunks<details::fromstring_chunk<T>>(
+            first, first + string.size(), is_boundary, parse);
+
+        long size = 0;
+        for (auto const &chunk : chunks) {
+          size += chunk.values.size();
+          if (chunk.stopped)
+            break;
+        }
+        types::ndarray<T, 1> res(types::array<long, 1>{{size}},
+                                 __builtin__::None);
+        T *out = res.buffer;
+        for (auto const &chunk : chunks) {
+          out = std::copy(chunk.values.begin(), chunk.values.end(), out);
+          if (chunk.stopped)
+            break;
+        }
+        return res;
       } else {
+        long size = string.size() / sizeof(T);
         if (count < 0)
-          count = string.size();
+          count = size;
+        else if (count > size)
+          throw types::ValueError("string is smaller than requested size");
         long shape[1] = {count};
-        auto *buffer = (typename dtype::type *)malloc(
-            shape[0] * sizeof(typename dtype::type));
-        auto const *tstring =
-            reinterpret_cast<typename dtype::type const *>(string.c_str());
+        auto *buffer = (T *)malloc(shape[0] * sizeof(T));
+        auto const *tstring = reinterpret_cast<T const *>(string.chars());
         std::copy(tstring, tstring + shape[0], buffer);
         return {buffer, shape};
       }
@@ -5,6 +5,9 @@
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/sort.hpp"
+
+#include <numeric>
 
 namespace pythonic
 {
@@ -15,37 +18,34 @@ namespace pythonic
     namespace details
     {
 
+      /* Stably sorts ``indices'' according to the I-th key, after it has been
+       * sorted according to the previous keys: the last key ends up being the
+       * primary one.
+       */
       template <size_t I>
-      struct lexcmp_nth {
+      struct lexsort_pass {
         template <class K>
-        bool operator()(K const &keys, long i0, long i1) const
+        void operator()(K const &keys, long *indices, long *order,
+                        long *tmp, long n) const
         {
-          if (std::get<I - 1>(keys)[i0] < std::get<I - 1>(keys)[i1])
-            return true;
-          else if (std::get<I - 1>(keys)[i0] > std::get<I - 1>(keys)[i1])
-            return false;
-          else
-            return lexcmp_nth<I - 1>{}(keys, i0, i1);
+          lexsort_pass<I - 1>{}(keys, indices, order, tmp, n);
+          auto const &key = std::get<I - 1>(keys);
+          using T = typename std::decay<decltype(key[0L])>::type;
+          scratch_buffer<T> buffer;
+          T *values = buffer.get(n);
+          for (long i = 0; i < n; ++i)
+            values[i] = key[indices[i]];
+          sorter<T>{}.argsort(values, values + n, order);
+          for (long i = 0; i < n; ++i)
+            tmp[i] = indices[order[i]];
+          std::copy(tmp, tmp + n, indices);
         }
       };
       template <>
-      struct lexcmp_nth<0> {
+      struct lexsort_pass<0> {
         template <class K>
-        bool operator()(K const &keys, long i0, long i1) const
-        {
-          return false;
-        }
-      };
-
-      template <class K>
-      struct lexcmp {
-        K const &keys;
-        lexcmp(K const &keys) : keys(keys)
-        {
-        }
-        bool operator()(long i0, long i1)
+        void operator()(K const &, long *, long *, long *, long) const
         {
-          return lexcmp_nth<std::tuple_size<K>::value>{}(keys, i0, i1);
         }
       };
 
@@ -56,8 +56,10 @@ namespace pythonic
         types::ndarray<long, 1> out(types::make_tuple(n), __builtin__::None);
         // fill with the original indices
         std::iota(out.buffer, out.buffer + n, 0L);
-        // then sort using keys as the comparator
-        std::sort(out.buffer, out.buffer + n, details::lexcmp<K>(keys));
+        // then sort them key after key, from the least significant one
+        std::vector<long> order(n), tmp(n);
+        lexsort_pass<std::tuple_size<K>::value>{}(keys, out.buffer,
+                                                  order.data(), tmp.data(), n);
         return out;
       }
     }
@@ -0,0 +1,222 @@
+#ifndef PYTHONIC_NUMPY_LOADTXT_HPP
+#define PYTHONIC_NUMPY_LOADTXT_HPP
+
+#include "pythonic/include/numpy/loadtxt.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/text_parser.hpp"
+#include "pythonic/numpy/float64.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/types/exceptions.hpp"
+#include "pythonic/types/file.hpp"
+#include "pythonic/types/str.hpp"
+#include "pythonic/__builtin__/None.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      std::string loadtxt_option(types::none_type const &)
+      {
+        return {};
+      }
+
+      std::string loadtxt_option(types::str const &option)
+      {
+        return {option.begin(), option.end()};
+      }
+
+      std::vector<long> loadtxt_columns(types::none_type const &)
+      {
+        return {};
+      }
+
+      std::vector<long> loadtxt_columns(long column)
+      {
+        return {column};
+      }
+
+      template <class U>
+      std::vector<long> loadtxt_columns(U const &columns)
+      {
+        return {columns.begin(), columns.end()};
+      }
+
+      struct loadtxt_options {
+        std::string comments;  // empty if there are no comments
+        std::string delimiter; // empty for any whitespace
+        std::vector<long> usecols; // empty for all the columns
+      };
+
+      template <class T>
+      struct loadtxt_chunk {
+        std::vector<T> values;
+        long rows = 0;
+        long width = -1; // number of columns of the rows, if any
+        char const *error = nullptr;
+      };
+
+      using token = std::pair<char const *, char const *>;
+
+      template <class T>
+      bool loadtxt_value(token const &tok, loadtxt_chunk<T> &chunk)
+      {
+        char const *first = utils::skip_spaces(tok.first, tok.second);
+        char const *last = tok.second;
+        while (last != first and utils::is_space(last[-1]))
+          --last;
+        T value;
+        if (first == last or utils::parse_number(first, last, value) != last) {
+          chunk.error = "could not convert string to number";
+          return false;
+        }
+        chunk.values.push_back(value);
+        return true;
+      }
+
+      template <class T>
+      void loadtxt_line(char const *first, char const *last,
+                        loadtxt_options const &options,
+                        std::vector<token> &tokens, loadtxt_chunk<T> &chunk)
+      {
+        if (not options.comments.empty())
+          last = std::search(first, last, options.comments.begin(),
+                             options.comments.end());
+        first = utils::skip_spaces(first, last);
+        while (last != first and utils::is_space(last[-1]))
+          --last;
+        if (first == last)
+          return;
+
+        std::string const &delimiter = options.delimiter;
+        tokens.clear();
+        if (delimiter.empty()) {
+          while (first != last) {
+            char const *end = std::find_if(first, last, utils::is_space);
+            tokens.emplace_back(first, end);
+            first = utils::skip_spaces(end, last);
+          }
+        } else {
+          while (true) {
+            char const *end =
+                delimiter.size() == 1
+                    ? static_cast<char const *>(
+                          memchr(first, delimiter[0], last - first))
+                    : std::search(first, last, delimiter.begin(),
+                                  delimiter.end());
+            if (end == nullptr)
+              end = last;
+            tokens.emplace_back(first, end);
+            if (end == last)
+              break;
+            first = end + delimiter.size();
+          }
+        }
+
+        long const width = tokens.size();
+        if (options.usecols.empty()) {
+          if (chunk.width == -1)
+            chunk.width = width;
+          else if (chunk.width != width) {
+            chunk.error = "wrong number of columns";
+            return;
+          }
+          for (auto const &tok : tokens)
+            if (not loadtxt_value(tok, chunk))
+              return;
+        } else {
+          for (long column : options.usecols) {
+            if (column < 0)
+              column += width;
+            if (column < 0 or column >= width) {
+              chunk.error = "usecols index out of range";
+              return;
+            }
+            if (not loadtxt_value(tokens[column], chunk))
+              return;
+          }
+        }
+        ++chunk.rows;
+      }
+
+      template <class T>
+      loadtxt_chunk<T> loadtxt_lines(char const *first, char const *last,
+                                     loadtxt_options const &options)
+      {
+        loadtxt_chunk<T> chunk;
+        std::vector<token> tokens;
+        while (first != last and not chunk.error) {
+          auto eol =
+              static_cast<char const *>(memchr(first, '\n', last - first));
+          char const *line_end = eol ? eol : last;
+          loadtxt_line(first, line_end, options, tokens, chunk);
+          first = eol ? eol + 1 : last;
+        }
+        return chunk;
+      }
+    }
+
+    template <class dtype, class C, class D, class U>
+    types::ndarray<typename dtype::type, details::loadtxt_dim<U>::value>
+    loadtxt(types::str const &fname, dtype d, C const &comments,
+            D const &delimiter, types::none_type const &converters,
+            long skiprows, U const &usecols)
+    {
+      using T = typename dtype::type;
+      constexpr size_t N = details::loadtxt_dim<U>::value;
+      details::loadtxt_options const options{
+          details::loadtxt_option(comments),
+          details::loadtxt_option(delimiter), details::loadtxt_columns(usecols)};
+
+      types::str content = types::file(fname).read();
+      char const *first = content.chars();
+      char const *last = first + content.size();
+      for (; skiprows > 0 and first != last; --skiprows) {
+        auto eol = static_cast<char const *>(memchr(first, '\n', last - first));
+        first = eol ? eol + 1 : last;
+      }
+
+      auto chunks = utils::parse_chunks<details::loadtxt_chunk<T>>(
+          first, last, [](char c) { return c == '\n'; },
+          [&options](char const *first, char const *last) {
+            return details::loadtxt_lines<T>(first, last, options);
+          });
+
+      long rows = 0;
+      long columns = options.usecols.empty() ? -1 : options.usecols.size();
+      for (auto const &chunk : chunks) {
+        if (chunk.error)
+          throw types::ValueError(chunk.error);
+        if (columns == -1)
+          columns = chunk.width;
+        else if (chunk.width != -1 and chunk.width != columns)
+          throw types::ValueError("wrong number of columns");
+        rows += chunk.rows;
+      }
+
+      types::array<long, N> shape;
+      shape[0] = rows;
+      if (N > 1)
+        shape[N - 1] = std::max(columns, 0L);
+      types::ndarray<T, N> res(shape, __builtin__::None);
+      T *out = res.buffer;
+      for (auto const &chunk : chunks)
+        out = std::copy(chunk.values.begin(), chunk.values.end(), out);
+      return res;
+    }
+
+    DEFINE_FUNCTOR(pythonic::numpy, loadtxt);
+  }
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef PYTHONIC_NUMPY_MATMUL_HPP
+#define PYTHONIC_NUMPY_MATMUL_HPP
+
+#include "pythonic/include/numpy/matmul.hpp"
+
+#include "pythonic/numpy/dot.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/exceptions.hpp"
+#include "pythonic/utils/functor.hpp"
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      /* Shape and strides of the operand as a stack of ``N''-2 matrices,
+       * a vector being a single row if ``row'' is true, a single column
+       * otherwise.
+       */
+      template <size_t N, size_t M>
+      void matmul_operand(types::array<long, M> const &shape,
+                          types::array<long, M> const &strides, bool row,
+                          types::array<long, N> &out_shape,
+                          types::array<long, N> &out_strides)
+      {
+        std::fill(out_shape.begin(), out_shape.end(), 1);
+        std::fill(out_strides.begin(), out_strides.end(), 0);
+        if (M == 1) {
+          out_shape[row ? N - 1 : N - 2] = shape[0];
+          out_strides[row ? N - 1 : N - 2] = strides[0];
+        } else {
+          std::copy(shape.begin(), shape.end(), out_shape.end() - M);
+          std::copy(strides.begin(), strides.end(), out_strides.end() - M);
+        }
+      }
+    }
+
+    template <class E, class F>
+    typename std::enable_if<
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and E::value <= 2 and
+            F::value <= 2,
+        decltype(dot(std::declval<E>(), std::declval<F>()))>::type
+    matmul(E const &e, F const &f)
+    {
+      return dot(e, f);
+    }
+
+    template <class E, class F>
+    typename std::enable_if<
+        types::is_numexpr_arg<E>::value and
+            types::is_numexpr_arg<F>::value and
+            (E::value > 2 or F::value > 2),
+        types::ndarray<
+            typename __combined<typename E::dtype, typename F::dtype>::type,
+            details::matmul_dim<E, F>::value>>::type
+    matmul(E const &e, F const &f)
+    {
+      constexpr size_t N = details::matmul_dim<E, F>::batched;
+      details::strided_operand<E> a(e);
+      details::strided_operand<F> b(f);
+      types::array<long, N> a_shape, a_strides, b_shape, b_strides, shape;
+      details::matmul_operand(e.shape(), a.strides, true, a_shape, a_strides);
+      details::matmul_operand(f.shape(), b.strides, false, b_shape,
+                              b_strides);
+
+      if (a_shape[N - 1] != b_shape[N - 2])
+        throw types::ValueError("matmul: mismatch in core dimension");
+      for (size_t i = 0; i < N - 2; ++i) {
+        if (a_shape[i] != b_shape[i] and a_shape[i] != 1 and b_shape[i] != 1)
+          throw types::ValueError("operands could not be broadcast together");
+        shape[i] = std::max(a_shape[i], b_shape[i]);
+        if (a_shape[i] == 1)
+          a_strides[i] = 0;
+        if (b_shape[i] == 1)
+          b_strides[i] = 0;
+      }
+      shape[N - 2] = a_shape[N - 2];
+      shape[N - 1] = b_shape[N - 1];
+
+      // the axes of the vectors have a single element, so they can be
+      // dropped without moving the others
+      types::array<long, details::matmul_dim<E, F>::value> out_shape;
+      auto iter = std::copy(shape.begin(), shape.end() - 2, out_shape.begin());
+      if (E::value != 1)
+        *iter++ = shape[N - 2];
+      if (F::value != 1)
+        *iter++ = shape[N - 1];
+      types::ndarray<
+          typename __combined<typename E::dtype, typename F::dtype>::type,
+          details::matmul_dim<E, F>::value>
+      out(out_shape, __builtin__::None);
+      details::batched_product(shape, a_shape[N - 1], a.data, a_strides, b.data,
+                               b_strides, out.buffer);
+      return out;
+    }
+
+    DEFINE_FUNCTOR(pythonic::numpy, matmul);
+  }
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/numpy/asarray.hpp"
+#include "pythonic/numpy/percentile.hpp"
 #include <algorithm>
 
 namespace pythonic
@@ -14,25 +15,28 @@ namespace pythonic
   namespace numpy
   {
     template <class T, size_t N>
-    decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> const &arr)
+    decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> const &arr,
+                                            types::none_type)
     {
-      size_t n = arr.flat_size();
-      T *tmp = new T[n];
-      std::copy(arr.buffer, arr.buffer + n, tmp);
-      std::sort(tmp, tmp + n);
-      auto out = (tmp[n / 2] + tmp[(n - 1) / 2]) / double(2);
-      delete[] tmp;
-      return out;
+      types::ndarray<T, N> tmp = arr.copy();
+      return details::lane_median(tmp.buffer, tmp.buffer + tmp.flat_size());
     }
 
     template <class T, size_t N>
-    decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> &&arr)
+    decltype(std::declval<T>() + 1.) median(types::ndarray<T, N> &&arr,
+                                            types::none_type)
     {
-      size_t n = arr.flat_size();
-      T *tmp = arr.buffer;
-      std::sort(tmp, tmp + n);
-      auto out = (tmp[n / 2] + tmp[(n - 1) / 2]) / double(2);
-      return out;
+      return details::lane_median(arr.buffer, arr.buffer + arr.flat_size());
+    }
+
+    template <class T, size_t N>
+    typename details::lane_reduce_result<decltype(std::declval<T>() + 1.),
+                                         N>::type
+    median(types::ndarray<T, N> const &arr, long axis)
+    {
+      types::ndarray<T, N> tmp = arr.copy();
+      return details::reduce_lanes<decltype(std::declval<T>() + 1.)>(
+          tmp, axis, &details::lane_median<T>);
     }
 
     NUMPY_EXPR_TO_NDARRAY0_IMPL(median);
@@ -0,0 +1,216 @@
+#ifndef PYTHONIC_NUMPY_PERCENTILE_HPP
+#define PYTHONIC_NUMPY_PERCENTILE_HPP
+
+#include "pythonic/include/numpy/percentile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/sort.hpp"
+#include "pythonic/__builtin__/None.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      template <class T>
+      bool has_nan(T const *first, T const *last, std::true_type)
+      {
+        return std::any_of(first, last, [](T v) { return v != v; });
+      }
+
+      template <class T>
+      bool has_nan(T const *, T const *, std::false_type)
+      {
+        return false;
+      }
+
+      template <class T>
+      quantile_type<T> lane_median(T *first, T *last)
+      {
+        long n = last - first;
+        // as numpy does, the median of a lane holding a nan is nan
+        if (n == 0 or has_nan(first, last, std::is_floating_point<T>()))
+          return std::numeric_limits<quantile_type<T>>::quiet_NaN();
+        T *middle = first + n / 2;
+        std::nth_element(first, middle, last);
+        // for even sizes, the other middle value is the largest of the lower
+        // half
+        T other = n % 2 ? *middle : *std::max_element(first, middle);
+        return (*middle + other) / double(2);
+      }
+
+      template <class T>
+      void lane_quantiles(T *first, T *last, double const *qs,
+                          long const *order, long n, quantile_type<T> *out)
+      {
+        using R = quantile_type<T>;
+        long size = last - first;
+        if (size == 0 or has_nan(first, last, std::is_floating_point<T>())) {
+          for (long i = 0; i < n; ++i)
+            out[i] = std::numeric_limits<R>::quiet_NaN();
+          return;
+        }
+        // quantiles are selected in increasing order, so that each selection
+        // only needs to scan the values above the previous one
+        T *start = first;
+        for (long i = 0; i < n; ++i) {
+          double index = qs[order[i]] * (size - 1);
+          long lo = std::min<long>(std::floor(index), size - 1);
+          double t = index - lo;
+          T *pos = first + lo;
+          std::nth_element(start, pos, last);
+          start = pos;
+          R a = *pos;
+          if (t == 0) {
+            out[order[i]] = a;
+            continue;
+          }
+          R b = *std::min_element(pos + 1, last);
+          R diff = b - a;
+          // same linear interpolation as numpy
+          out[order[i]] = t >= 0.5 ? b - diff * (1 - t) : a + diff * t;
+        }
+      }
+
+      template <class T>
+      quantile_type<T> lane_quantile(T *first, T *last, double q)
+      {
+        long const order = 0;
+        quantile_type<T> out;
+        lane_quantiles(first, last, &q, &order, 1, &out);
+        return out;
+      }
+
+      template <class R, class F>
+      struct lane_reduce_kernel {
+        R *out;
+        F f;
+        template <class T>
+        void operator()(T *first, T *last, long lane)
+        {
+          out[lane] = f(first, last);
+        }
+      };
+
+      template <class R, class T, class F>
+      R reduce_lanes_impl(types::ndarray<T, 1> &arr, long, F const &f)
+      {
+        return f(arr.buffer, arr.buffer + arr.flat_size());
+      }
+
+      template <class R, class T, size_t N, class F>
+      types::ndarray<R, N - 1> reduce_lanes_impl(types::ndarray<T, N> &arr,
+                                                 long axis, F const &f)
+      {
+        auto &&shape = arr.shape();
+        types::array<long, N - 1> out_shape;
+        std::copy(shape.begin(), shape.begin() + axis, out_shape.begin());
+        std::copy(shape.begin() + axis + 1, shape.end(),
+                  out_shape.begin() + axis);
+        types::ndarray<R, N - 1> out(out_shape, __builtin__::None);
+        if (shape[axis] == 0)
+          std::fill(out.buffer, out.buffer + out.flat_size(),
+                    std::numeric_limits<R>::quiet_NaN());
+        else
+          for_each_lane(arr, axis, lane_reduce_kernel<R, F>{out.buffer, f});
+        return out;
+      }
+
+      template <class R, class T, size_t N, class F>
+      typename lane_reduce_result<R, N>::type
+      reduce_lanes(types::ndarray<T, N> &arr, long axis, F const &f)
+      {
+        if (axis < -long(N) or axis >= long(N))
+          throw types::ValueError("axis out of bounds");
+        if (axis < 0)
+          axis += N;
+        return reduce_lanes_impl<R>(arr, axis, f);
+      }
+
+      template <class T, size_t N>
+      quantile_type<T> quantile(types::ndarray<T, N> const &a, double q,
+                                types::none_type)
+      {
+        // the selection reorders values, so work on a copy
+        types::ndarray<T, N> values = a.copy();
+        return lane_quantile(values.buffer, values.buffer + values.flat_size(),
+                             q);
+      }
+
+      template <class T, size_t N>
+      typename lane_reduce_result<quantile_type<T>, N>::type
+      quantile(types::ndarray<T, N> const &a, double q, long axis)
+      {
+        types::ndarray<T, N> values = a.copy();
+        return reduce_lanes<quantile_type<T>>(
+            values, axis,
+            [q](T *first, T *last) { return lane_quantile(first, last, q); });
+      }
+
+      template <class T, size_t N>
+      types::ndarray<quantile_type<T>, 1>
+      quantile(types::ndarray<T, N> const &a, std::vector<double> const &qs,
+               types::none_type)
+      {
+        long n = qs.size();
+        std::vector<long> order(n);
+        std::iota(order.begin(), order.end(), 0L);
+        std::sort(order.begin(), order.end(),
+                  [&qs](long i, long j) { return qs[i] < qs[j]; });
+        types::ndarray<quantile_type<T>, 1> out(types::make_tuple(n),
+                                                __builtin__::None);
+        types::ndarray<T, N> values = a.copy();
+        lane_quantiles(values.buffer, values.buffer + values.flat_size(),
+                       qs.data(), order.data(), n, out.buffer);
+        return out;
+      }
+
+      double percentile_fraction(double q)
+      {
+        if (q < 0. or q > 100.)
+          throw types::ValueError("Percentiles must be in the range [0, 100]");
+        return q / 100.;
+      }
+    }
+
+    template <class T, size_t N>
+    details::quantile_type<T> percentile(types::ndarray<T, N> const &a,
+                                         double q, types::none_type axis)
+    {
+      return details::quantile(a, details::percentile_fraction(q), axis);
+    }
+
+    template <class T, size_t N>
+    typename details::lane_reduce_result<details::quantile_type<T>, N>::type
+    percentile(types::ndarray<T, N> const &a, double q, long axis)
+    {
+      return details::quantile(a, details::percentile_fraction(q), axis);
+    }
+
+    template <class T, size_t N, class Q>
+    typename std::enable_if<not std::is_arithmetic<Q>::value,
+                            types::ndarray<details::quantile_type<T>, 1>>::type
+    percentile(types::ndarray<T, N> const &a, Q const &qs,
+               types::none_type axis)
+    {
+      std::vector<double> fractions;
+      for (auto q : qs)
+        fractions.push_back(details::percentile_fraction(q));
+      return details::quantile(a, fractions, axis);
+    }
+
+    NUMPY_EXPR_TO_NDARRAY0_IMPL(percentile);
+    DEFINE_FUNCTOR(pythonic::numpy, percentile);
+  }
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef PYTHONIC_NUMPY_QUANTILE_HPP
+#define PYTHONIC_NUMPY_QUANTILE_HPP
+
+#include "pythonic/include/numpy/quantile.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/numpy/percentile.hpp"
+#include "pythonic/__builtin__/ValueError.hpp"
+
+namespace pythonic
+{
+
+  namespace numpy
+  {
+    namespace details
+    {
+      double quantile_fraction(double q)
+      {
+        if (q < 0. or q > 1.)
+          throw types::ValueError("Quantiles must be in the range [0, 1]");
+        return q;
+      }
+    }
+
+    template <class T, size_t N>
+    details::quantile_type<T> quantile(types::ndarray<T, N> const &a,
+                                       double q, types::none_type axis)
+    {
+      return details::quantile(a, details::quantile_fraction(q), axis);
+    }
+
+    template <class T, size_t N>
+    typename details::lane_reduce_result<details::quantile_type<T>, N>::type
+    quantile(types::ndarray<T, N> const &a, double q, long axis)
+    {
+      return details::quantile(a, details::quantile_fraction(q), axis);
+    }
+
+    template <class T, size_t N, class Q>
+    typename std::enable_if<not std::is_arithmetic<Q>::value,
+                            types::ndarray<details::quantile_type<T>, 1>>::type
+    quantile(types::ndarray<T, N> const &a, Q const &qs, types::none_type axis)
+    {
+      std::vector<double> fractions;
+      for (auto q : qs)
+        fractions.push_back(details::quantile_fraction(q));
+      return details::quantile(a, fractions, axis);
+    }
+
+    NUMPY_EXPR_TO_NDARRAY0_IMPL(quantile);
+    DEFINE_FUNCTOR(pythonic::numpy, quantile);
+  }
+}
+
+#endif
@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_BYTES_HPP
 
 #include "pythonic/include/numpy/random/bytes.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/str.hpp"
 #include "pythonic/utils/functor.hpp"
@@ -20,12 +20,13 @@ namespace pythonic
       types::str bytes(long length)
       {
         // dummy init + rewrite is faster than reserve and push_back
-        types::str result(std::string(length, 0));
+        std::string result(length, 0);
         std::uniform_int_distribution<long> distribution{0, 255};
-        std::generate(result.begin(), result.end(), [&]() {
-          return static_cast<char>(distribution(details::generator));
+        details::fill(&result[0], length, [distribution](
+            details::default_numpy_generator_t &generator) mutable {
+          return static_cast<char>(distribution(generator));
         });
-        return result;
+        return {std::move(result)};
       }
 
       DEFINE_FUNCTOR(pythonic::numpy::random, bytes);
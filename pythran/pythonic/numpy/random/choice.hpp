@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_CHOICE_HPP
 
 #include "pythonic/include/numpy/random/choice.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/__builtin__/NotImplementedError.hpp"
 #include "pythonic/numpy/random/randint.hpp"
@@ -34,8 +34,7 @@ namespace pythonic
 
         types::ndarray<long, S> result{shape, types::none_type()};
         std::discrete_distribution<long> distribution{p.begin(), p.end()};
-        std::generate(result.fbegin(), result.fend(),
-                      [&]() { return distribution(details::generator); });
+        details::fill(result.buffer, result.flat_size(), distribution);
         return result;
       }
 
@@ -80,8 +79,11 @@ namespace pythonic
 
         types::ndarray<typename T::dtype, S> result{shape, types::none_type()};
         std::uniform_int_distribution<long> distribution{0, a.size() - 1};
-        std::generate(result.fbegin(), result.fend(),
-                      [&]() { return a[distribution(details::generator)]; });
+        auto draw = [&a, distribution](
+            details::default_numpy_generator_t &generator) mutable {
+          return a[distribution(generator)];
+        };
+        details::fill(result.buffer, result.flat_size(), draw);
         return result;
       }
 
@@ -106,8 +108,11 @@ namespace pythonic
 
         types::ndarray<typename T::dtype, S> result{shape, types::none_type()};
         std::discrete_distribution<long> distribution{p.begin(), p.end()};
-        std::generate(result.fbegin(), result.fend(),
-                      [&]() { return a[distribution(details::generator)]; });
+        auto draw = [&a, distribution](
+            details::default_numpy_generator_t &generator) mutable {
+          return a[distribution(generator)];
+        };
+        details::fill(result.buffer, result.flat_size(), draw);
         return result;
       }
 
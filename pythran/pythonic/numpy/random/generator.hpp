@@ -0,0 +1,38 @@
+#ifndef PYTHONIC_NUMPY_RANDOM_GENERATOR_HPP
+#define PYTHONIC_NUMPY_RANDOM_GENERATOR_HPP
+
+#include "pythonic/include/numpy/random/generator.hpp"
+
+#include "pythonic/utils/philox.hpp"
+
+namespace pythonic
+{
+  namespace numpy
+  {
+    namespace random
+    {
+      namespace details
+      {
+        utils::thread_random &local_random()
+        {
+          static thread_local utils::thread_random local;
+          local.sync(state);
+          return local;
+        }
+
+        default_numpy_generator_t &generator()
+        {
+          return local_random().generator;
+        }
+
+        template <class T, class Draw>
+        void fill(T *first, long size, Draw const &draw)
+        {
+          utils::random_fill(local_random(), first, size, draw);
+        }
+      }
+    }
+  }
+}
+
+#endif
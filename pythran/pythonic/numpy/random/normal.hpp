@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_NORMAL_HPP
 
 #include "pythonic/include/numpy/random/normal.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/NoneType.hpp"
@@ -25,8 +25,7 @@ namespace pythonic
       {
         types::ndarray<double, N> result{shape, types::none_type()};
         std::normal_distribution<double> distribution{loc, scale};
-        std::generate(result.fbegin(), result.fend(),
-                      [&]() { return distribution(details::generator); });
+        details::fill(result.buffer, result.flat_size(), distribution);
         return result;
       }
 
@@ -38,7 +37,8 @@ namespace pythonic
 
       double normal(double loc, double scale, types::none_type d)
       {
-        return std::normal_distribution<double>{loc, scale}(details::generator);
+        return std::normal_distribution<double>{loc,
+                                                scale}(details::generator());
       }
 
       DEFINE_FUNCTOR(pythonic::numpy::random, normal);
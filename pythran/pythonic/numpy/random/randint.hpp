@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_RANDINT_HPP
 
 #include "pythonic/include/numpy/random/randint.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/tuple.hpp"
@@ -23,8 +23,7 @@ namespace pythonic
       {
         types::ndarray<long, N> result{shape, types::none_type()};
         std::uniform_int_distribution<long> distribution{min, max - 1};
-        std::generate(result.fbegin(), result.fend(),
-                      [&]() { return distribution(details::generator); });
+        details::fill(result.buffer, result.flat_size(), distribution);
         return result;
       }
 
@@ -36,14 +35,14 @@ namespace pythonic
 
       long randint(long max)
       {
-        return std::uniform_int_distribution<long>{0,
-                                                   max - 1}(details::generator);
+        return std::uniform_int_distribution<long>{0, max - 1}(
+            details::generator());
       }
 
       long randint(long min, long max)
       {
-        return std::uniform_int_distribution<long>{min,
-                                                   max - 1}(details::generator);
+        return std::uniform_int_distribution<long>{min, max - 1}(
+            details::generator());
       }
 
       DEFINE_FUNCTOR(pythonic::numpy::random, randint);
@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_RANDOM_HPP
 
 #include "pythonic/include/numpy/random/random.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/NoneType.hpp"
@@ -24,8 +24,7 @@ namespace pythonic
       {
         types::ndarray<double, N> result{shape, types::none_type()};
         std::uniform_real_distribution<double> distribution{0., 1.};
-        std::generate(result.fbegin(), result.fend(),
-                      [&]() { return distribution(details::generator); });
+        details::fill(result.buffer, result.flat_size(), distribution);
         return result;
       }
 
@@ -37,7 +36,7 @@ namespace pythonic
       double random(types::none_type d)
       {
         return std::uniform_real_distribution<double>{0.,
-                                                      1.}(details::generator);
+                                                      1.}(details::generator());
       }
 
       DEFINE_FUNCTOR(pythonic::numpy::random, random);
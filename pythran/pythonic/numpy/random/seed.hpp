@@ -0,0 +1,36 @@
+#ifndef PYTHONIC_NUMPY_RANDOM_SEED_HPP
+#define PYTHONIC_NUMPY_RANDOM_SEED_HPP
+
+#include "pythonic/include/numpy/random/seed.hpp"
+
+#include "pythonic/utils/functor.hpp"
+#include "pythonic/types/NoneType.hpp"
+#include "pythonic/numpy/random/generator.hpp"
+#include "pythonic/__builtin__/None.hpp"
+
+#include <random>
+
+namespace pythonic
+{
+  namespace numpy
+  {
+    namespace random
+    {
+      types::none_type seed(long s)
+      {
+        details::state.reseed(s);
+        return __builtin__::None;
+      }
+
+      types::none_type seed(types::none_type)
+      {
+        details::state.reseed(std::random_device()());
+        return __builtin__::None;
+      }
+
+      DEFINE_FUNCTOR(pythonic::numpy::random, seed);
+    }
+  }
+}
+
+#endif
@@ -2,7 +2,7 @@
 #define PYTHONIC_NUMPY_RANDOM_STANDARD_NORMAL_HPP
 
 #include "pythonic/include/numpy/random/standard_normal.hpp"
-#include "pythonic/include/numpy/random/generator.hpp"
+#include "pythonic/numpy/random/generator.hpp"
 
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/NoneType.hpp"
@@ -9,19 +9,149 @@
 #include "pythonic/utils/neutral.hpp"
 
 #include <algorithm>
+#include <memory>
 
 namespace pythonic
 {
 
   namespace numpy
   {
+    namespace details
+    {
+      /* combine the ``n'' partial results starting at ``first'' pairwise */
+      template <class Op, class F>
+      F combine_pairwise(F const *first, long n)
+      {
+        if (n == 1)
+          return first[0];
+        long half = n / 2;
+        F left = combine_pairwise<Op>(first, half);
+        Op{}(left, combine_pairwise<Op>(first + half, n - half));
+        return left;
+      }
+
+      /* storage for ``n'' partial results, only allocated when there are
+       * too many of them to fit on the stack, so that small nested
+       * reductions do not allocate */
+      template <class F>
+      class partials_buffer
+      {
+        F stack_storage[PYTHRAN_REDUCE_STACK_PARTIALS];
+        std::unique_ptr<F[]> heap_storage;
+        F *storage;
+
+      public:
+        partials_buffer(long n)
+            : heap_storage(n > PYTHRAN_REDUCE_STACK_PARTIALS ? new F[n]
+                                                             : nullptr),
+              storage(heap_storage ? heap_storage.get() : stack_storage)
+        {
+        }
+        partials_buffer(partials_buffer const &) = delete;
+
+        F &operator[](long i)
+        {
+          return storage[i];
+        }
+        F const *data() const
+        {
+          return storage;
+        }
+      };
+
+      /* split point of [lo, hi) for the pairwise recursion, aligned on a
+       * block boundary */
+      long pairwise_split(long lo, long hi)
+      {
+        long half = (hi - lo) / 2 / PYTHRAN_REDUCE_BLOCK_SIZE *
+                    PYTHRAN_REDUCE_BLOCK_SIZE;
+        return lo + (half ? half : PYTHRAN_REDUCE_BLOCK_SIZE);
+      }
+
+      /* pairwise reduction of the elements [lo, hi) of a one dimensional
+       * expression, starting from ``neutral'' */
+      template <class Op, bool vector_form>
+      struct pairwise_reduce {
+        template <class E, class F>
+        F operator()(E const &e, long lo, long hi, F neutral) const
+        {
+          if (hi - lo > PYTHRAN_REDUCE_BLOCK_SIZE) {
+            long mid = pairwise_split(lo, hi);
+            F left = (*this)(e, lo, mid, neutral);
+            Op{}(left, (*this)(e, mid, hi, neutral));
+            return left;
+          }
+          F acc = neutral;
+          auto iter = e.begin() + lo;
+          for (long i = lo; i < hi; ++i, ++iter)
+            Op{}(acc, *iter);
+          return acc;
+        }
+      };
+
+#ifdef USE_BOOST_SIMD
+      template <class Op>
+      struct pairwise_reduce<Op, true> {
+        template <class E, class F>
+        F operator()(E const &e, long lo, long hi, F neutral) const
+        {
+          if (hi - lo > PYTHRAN_REDUCE_BLOCK_SIZE) {
+            long mid = pairwise_split(lo, hi);
+            F left = (*this)(e, lo, mid, neutral);
+            Op{}(left, (*this)(e, mid, hi, neutral));
+            return left;
+          }
+          using T = typename E::dtype;
+          using vT = boost::simd::pack<T>;
+          static const long vN = vT::static_size;
+          static_assert(PYTHRAN_REDUCE_BLOCK_SIZE % vN == 0,
+                        "blocks are made of full vectors");
+          // lo is on a block boundary, thus on a vector boundary
+          const long bound = (hi - lo) / vN;
+          F acc = neutral;
+          if (bound > 0) {
+            auto viter = e.vbegin() + lo / vN;
+            auto vacc = *viter;
+            ++viter;
+            for (long i = 1; i < bound; ++i, ++viter)
+              Op{}(vacc, *viter);
+            alignas(sizeof(vT)) T stored[vN];
+            boost::simd::store(vacc, &stored[0]);
+            for (long j = 0; j < vN; ++j)
+              Op{}(acc, stored[j]);
+          }
+          auto iter = e.begin() + lo + bound * vN;
+          for (long i = lo + bound * vN; i < hi; ++i, ++iter)
+            Op{}(acc, *iter);
+          return acc;
+        }
+      };
+#endif
+    }
+
     template <class Op, size_t N, bool vector_form>
     struct _reduce {
       template <class E, class F>
       F operator()(E e, F acc)
       {
-        for (auto const &value : e)
-          acc = _reduce<Op, N - 1, vector_form>{}(value, acc);
+        // rows are reduced independently, then combined pairwise
+        const long n = std::distance(e.begin(), e.end());
+        if (n == 0)
+          return acc;
+        F neutral = utils::neutral<Op, typename E::dtype>::value;
+        details::partials_buffer<F> partials(n);
+        auto begin = e.begin();
+#ifdef _OPENMP
+        if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+          for (long i = 0; i < n; ++i)
+            partials[i] =
+                _reduce<Op, N - 1, vector_form>{}(*(begin + i), neutral);
+        else
+#endif
+          for (long i = 0; i < n; ++i, ++begin)
+            partials[i] = _reduce<Op, N - 1, vector_form>{}(*begin, neutral);
+        Op{}(acc, details::combine_pairwise<Op>(partials.data(), n));
         return acc;
       }
     };
@@ -31,44 +161,99 @@ namespace pythonic
       template <class E, class F>
       F operator()(E e, F acc)
       {
-        for (auto const &value : e)
-          Op{}(acc, value);
+        const long n = std::distance(e.begin(), e.end());
+        if (n == 0)
+          return acc;
+        F neutral = utils::neutral<Op, typename E::dtype>::value;
+        const long nchunks =
+            (n + PYTHRAN_REDUCE_CHUNK_SIZE - 1) / PYTHRAN_REDUCE_CHUNK_SIZE;
+        details::pairwise_reduce<Op, vector_form> chunk_reduce;
+        if (nchunks == 1) {
+          Op{}(acc, chunk_reduce(e, 0, n, neutral));
+          return acc;
+        }
+        details::partials_buffer<F> partials(nchunks);
+#ifdef _OPENMP
+        if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+          for (long i = 0; i < nchunks; ++i)
+            partials[i] = chunk_reduce(
+                e, i * PYTHRAN_REDUCE_CHUNK_SIZE,
+                std::min(n, (i + 1) * PYTHRAN_REDUCE_CHUNK_SIZE), neutral);
+        else
+#endif
+          for (long i = 0; i < nchunks; ++i)
+            partials[i] = chunk_reduce(
+                e, i * PYTHRAN_REDUCE_CHUNK_SIZE,
+                std::min(n, (i + 1) * PYTHRAN_REDUCE_CHUNK_SIZE), neutral);
+        Op{}(acc, details::combine_pairwise<Op>(partials.data(), nchunks));
         return acc;
       }
     };
 
-#ifdef USE_BOOST_SIMD
-    template <class Op>
-    struct _reduce<Op, 1, true> {
-      template <class E, class F>
-      F operator()(E e, F acc)
-      {
-        using T = typename E::dtype;
-        using vT = boost::simd::pack<T>;
-        static const size_t vN = vT::static_size;
-        const long n = e.size();
-        auto viter = e.vbegin(), vend = e.vend();
-        const long bound = std::distance(viter, vend);
-        ;
-        if (bound > 0) {
-          auto vacc = *viter;
-          ++viter;
-          for (long i = 1; i < bound; ++i, ++viter)
-            Op{}(vacc, *viter);
-          alignas(sizeof(vT)) T stored[vN];
-          boost::simd::store(vacc, &stored[0]);
-          for (size_t j = 0; j < vN; ++j)
-            Op{}(acc, stored[j]);
-        }
-        auto iter = e.begin() + bound * vN;
+    /* accumulate the rows [lo, hi) of ``array'' into ``acc'', in order */
+    template <class Op, class E, class A>
+    void _accumulate_rows(E const &array, long lo, long hi, A &acc)
+    {
+      auto iter = array.begin() + lo;
+      for (long i = lo; i < hi; ++i, ++iter)
+        Op{}(acc, *iter);
+    }
 
-        for (long i = bound * vN; i < n; ++i, ++iter) {
-          Op{}(acc, *iter);
-        }
+    /* Reduction of the ``n'' rows of ``array''.
+     *
+     * Rows are split in at most PYTHRAN_REDUCE_ROW_PARTS parts made of whole
+     * blocks of PYTHRAN_REDUCE_BLOCK_SIZE rows, a split that only depends on
+     * ``n''. Each part is accumulated into its own row of a single buffer,
+     * possibly in parallel, then parts are combined pairwise, so that the
+     * result does not depend on the number of threads.
+     */
+    template <class Op, class E, class S>
+    types::ndarray<typename E::dtype, E::value - 1>
+    _reduce_rows(E const &array, long n, S const &shape)
+    {
+      using T = typename E::dtype;
+      const long nblocks =
+          (n + PYTHRAN_REDUCE_BLOCK_SIZE - 1) / PYTHRAN_REDUCE_BLOCK_SIZE;
+      const long nparts =
+          std::min<long>(nblocks, PYTHRAN_REDUCE_ROW_PARTS);
+      if (nparts == 1) {
+        types::ndarray<T, E::value - 1> acc{shape,
+                                            utils::neutral<Op, T>::value};
+        _accumulate_rows<Op>(array, 0, n, acc);
         return acc;
       }
-    };
+
+      types::array<long, E::value> parts_shape;
+      parts_shape[0] = nparts;
+      std::copy(shape.begin(), shape.end(), parts_shape.begin() + 1);
+      types::ndarray<T, E::value> parts{parts_shape,
+                                        utils::neutral<Op, T>::value};
+      auto reduce_part = [&array, &parts, n, nblocks, nparts](long p) {
+        long lo = nblocks * p / nparts * PYTHRAN_REDUCE_BLOCK_SIZE;
+        long hi =
+            std::min(n, nblocks * (p + 1) / nparts * PYTHRAN_REDUCE_BLOCK_SIZE);
+        auto acc = parts[p];
+        _accumulate_rows<Op>(array, lo, hi, acc);
+      };
+#ifdef _OPENMP
+      if (parts.flat_size() / nparts * n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+        for (long p = 0; p < nparts; ++p)
+          reduce_part(p);
+      else
 #endif
+        for (long p = 0; p < nparts; ++p)
+          reduce_part(p);
+
+      for (long step = 1; step < nparts; step *= 2)
+        for (long p = 0; p + step < nparts; p += 2 * step) {
+          // operators only update lvalues
+          auto left = parts[p];
+          Op{}(left, parts[p + step]);
+        }
+      return parts[0];
+    }
 
     template <class Op, class E>
     typename std::enable_if<types::is_numexpr_arg<E>::value,
@@ -123,18 +308,29 @@ namespace pythonic
       if (axis == 0) {
         types::array<long, E::value - 1> shp;
         std::copy(shape.begin() + 1, shape.end(), shp.begin());
-        return _reduce<Op, 1, false /* not on scalars*/>{}(
-            array,
-            reduced_type<E>{shp, utils::neutral<Op, typename E::dtype>::value});
+        if (shape[0] == 0)
+          return reduced_type<E>{shp,
+                                 utils::neutral<Op, typename E::dtype>::value};
+        return _reduce_rows<Op>(array, shape[0], shp);
       } else {
         types::array<long, E::value - 1> shp;
         auto next = std::copy(shape.begin(), shape.begin() + axis, shp.begin());
         std::copy(shape.begin() + axis + 1, shape.end(), next);
         reduced_type<E> sumy{shp, __builtin__::None};
-        std::transform(array.begin(), array.end(), sumy.begin(),
-                       [axis](typename E::const_iterator::value_type other) {
-                         return reduce<Op>(other, axis - 1);
-                       });
+#ifdef _OPENMP
+        const long n = shape[0];
+        if (n >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+          auto abegin = array.begin();
+          auto sbegin = sumy.begin();
+#pragma omp parallel for
+          for (long i = 0; i < n; ++i)
+            *(sbegin + i) = reduce<Op>(*(abegin + i), axis - 1);
+        } else
+#endif
+          std::transform(array.begin(), array.end(), sumy.begin(),
+                         [axis](typename E::const_iterator::value_type other) {
+                           return reduce<Op>(other, axis - 1);
+                         });
         return sumy;
       }
     }
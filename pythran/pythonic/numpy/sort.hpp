@@ -4,6 +4,8 @@
 #include "pythonic/include/numpy/sort.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <numeric>
 
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
@@ -16,7 +18,8 @@ namespace pythonic
     template <class T>
     bool _comp(T const &i, T const &j)
     {
-      return i < j;
+      // nan are sorted at the end, as numpy does
+      return i < j or (j != j and i == i);
     }
 
     template <class T>
@@ -28,34 +31,281 @@ namespace pythonic
         return std::real(i) < std::real(j);
     }
 
-    template <class T, size_t N>
-    void _sort(types::ndarray<T, N> &out, long axis)
+    namespace details
     {
-      while (axis < 0)
-        axis += N;
-      axis = axis % N;
-      auto &&out_shape = out.shape();
-      const long step =
-          std::accumulate(out_shape.begin() + axis, out_shape.end(), 1L,
-                          std::multiplies<long>());
-      for (long i = 0; i < out.flat_size() / out_shape[axis] * step;
-           i += step) {
-        std::vector<T> to_sort;
-        T *iter = out.buffer + (i % out.flat_size() + i / out.flat_size());
-        while (iter !=
-               out.buffer + (i % out.flat_size() + i / out.flat_size()) +
-                   step) {
-          to_sort.push_back(*iter);
-          iter += step / out_shape[axis];
+      template <>
+      struct radix_uint<1> {
+        using type = uint8_t;
+      };
+      template <>
+      struct radix_uint<2> {
+        using type = uint16_t;
+      };
+      template <>
+      struct radix_uint<4> {
+        using type = uint32_t;
+      };
+      template <>
+      struct radix_uint<8> {
+        using type = uint64_t;
+      };
+
+      template <class T>
+      typename radix_traits<
+          T, typename std::enable_if<std::is_integral<T>::value>::type>::
+          key_type
+          radix_traits<T, typename std::enable_if<
+                              std::is_integral<T>::value>::type>::key(T v)
+      {
+        // flipping the sign bit moves negative values before positive ones
+        return key_type(v) ^
+               (std::is_signed<T>::value ? key_type(1) << (8 * sizeof(T) - 1)
+                                         : key_type(0));
+      }
+
+      template <class T>
+      typename radix_traits<
+          T,
+          typename std::enable_if<std::is_floating_point<T>::value and
+                                  (sizeof(T) == 4 or sizeof(T) == 8)>::type>::
+          key_type radix_traits<
+              T, typename std::enable_if<std::is_floating_point<T>::value and
+                                         (sizeof(T) == 4 or
+                                          sizeof(T) == 8)>::type>::key(T v)
+      {
+        static const key_type sign = key_type(1) << (8 * sizeof(T) - 1);
+        // nan are sorted at the end, as numpy does
+        if (v != v)
+          return ~key_type(0);
+        key_type k;
+        std::memcpy(&k, &v, sizeof(T));
+        // negative values are stored in sign-magnitude form, so their
+        // ordering is reversed
+        return (k & sign) ? ~k : (k | sign);
+      }
+
+      template <class T>
+      void radix_sort(T *first, T *last, T *tmp, long *payload, long *ptmp)
+      {
+        using traits = radix_traits<T>;
+        using key_type = typename traits::key_type;
+        static const size_t passes = sizeof(key_type);
+        long const n = last - first;
+
+        // histograms of every digit are computed in a single sweep
+        long counts[passes][256] = {};
+        for (long i = 0; i < n; ++i) {
+          key_type k = traits::key(first[i]);
+          for (size_t p = 0; p < passes; ++p)
+            ++counts[p][(k >> (8 * p)) & 0xff];
+        }
+
+        T *src = first, *dst = tmp;
+        long *psrc = payload, *pdst = ptmp;
+        for (size_t p = 0; p < passes; ++p) {
+          long *count = counts[p];
+          // skip digits shared by all the values
+          if (count[(traits::key(*src) >> (8 * p)) & 0xff] == n)
+            continue;
+          long offset = 0;
+          for (size_t d = 0; d < 256; ++d) {
+            long c = count[d];
+            count[d] = offset;
+            offset += c;
+          }
+          for (long i = 0; i < n; ++i) {
+            long pos = count[(traits::key(src[i]) >> (8 * p)) & 0xff]++;
+            dst[pos] = src[i];
+            if (payload)
+              pdst[pos] = psrc[i];
+          }
+          std::swap(src, dst);
+          std::swap(psrc, pdst);
+        }
+        if (src != first) {
+          std::copy(src, src + n, first);
+          if (payload)
+            std::copy(psrc, psrc + n, payload);
         }
-        std::sort(to_sort.begin(), to_sort.end(),
-                  static_cast<bool (*)(T const &, T const &)>(_comp));
-        iter = out.buffer + (i % out.flat_size() + i / out.flat_size());
-        for (auto val : to_sort) {
-          *iter = val;
-          iter += step / out_shape[axis];
+      }
+
+      template <class T>
+      scratch_buffer<T>::scratch_buffer()
+          : data_(), capacity_(0)
+      {
+      }
+
+      template <class T>
+      scratch_buffer<T>::scratch_buffer(scratch_buffer const &)
+          : scratch_buffer()
+      {
+      }
+
+      template <class T>
+      T *scratch_buffer<T>::get(long n)
+      {
+        if (n > capacity_) {
+          data_.reset(new T[n]);
+          capacity_ = n;
         }
+        return data_.get();
       }
+
+      template <class T, bool radix>
+      struct sort_dispatch;
+
+      template <class T>
+      struct sort_dispatch<T, false> {
+        static void sort(sorter<T> &, T *first, T *last)
+        {
+          std::sort(first, last,
+                    static_cast<bool (*)(T const &, T const &)>(_comp));
+        }
+        static void argsort(sorter<T> &s, T *first, T *last, long *order)
+        {
+          long n = last - first;
+          std::iota(order, order + n, 0L);
+          std::stable_sort(order, order + n, [first](long i, long j) {
+            return _comp(first[i], first[j]);
+          });
+          T *sorted = s.tmp.get(n);
+          for (long i = 0; i < n; ++i)
+            sorted[i] = first[order[i]];
+          std::copy(sorted, sorted + n, first);
+        }
+      };
+
+      template <class T>
+      struct sort_dispatch<T, true> {
+        static void sort(sorter<T> &s, T *first, T *last)
+        {
+          long n = last - first;
+          if (n < PYTHRAN_RADIX_SORT_THRESHOLD)
+            return sort_dispatch<T, false>::sort(s, first, last);
+          radix_sort(first, last, s.tmp.get(n), (long *)nullptr,
+                     (long *)nullptr);
+        }
+        static void argsort(sorter<T> &s, T *first, T *last, long *order)
+        {
+          long n = last - first;
+          if (n < PYTHRAN_RADIX_SORT_THRESHOLD)
+            return sort_dispatch<T, false>::argsort(s, first, last, order);
+          std::iota(order, order + n, 0L);
+          radix_sort(first, last, s.tmp.get(n), order, s.ptmp.get(n));
+        }
+      };
+
+      template <class T>
+      void sorter<T>::sort(T *first, T *last)
+      {
+        sort_dispatch<T, radix_traits<T>::value>::sort(*this, first, last);
+      }
+
+      template <class T>
+      void sorter<T>::argsort(T *first, T *last, long *order)
+      {
+        sort_dispatch<T, radix_traits<T>::value>::argsort(*this, first, last,
+                                                           order);
+      }
+
+      /* Walks through the lanes of an array along a given axis.
+       *
+       * A unit of work is either a single contiguous lane, or a block of at
+       * most PYTHRAN_SORT_LANE_BLOCK strided lanes.
+       */
+      template <class T>
+      struct lane_walker {
+        T *buffer;
+        long size;   // number of elements in a lane
+        long stride; // distance between two elements of a lane
+        long blocks; // number of lane blocks per outer index
+
+        template <class K>
+        void operator()(long unit, K &kernel,
+                        scratch_buffer<T> &scratch) const
+        {
+          if (stride == 1) {
+            T *first = buffer + unit * size;
+            kernel(first, first + size, unit);
+            return;
+          }
+          long outer = unit / blocks;
+          long j0 = (unit % blocks) * PYTHRAN_SORT_LANE_BLOCK;
+          long width = std::min<long>(PYTHRAN_SORT_LANE_BLOCK, stride - j0);
+          T *base = buffer + outer * size * stride + j0;
+          T *lanes = scratch.get(width * size);
+          for (long k = 0; k < size; ++k) {
+            T const *row = base + k * stride;
+            for (long b = 0; b < width; ++b)
+              lanes[b * size + k] = row[b];
+          }
+          for (long b = 0; b < width; ++b)
+            kernel(lanes + b * size, lanes + (b + 1) * size,
+                   outer * stride + j0 + b);
+          for (long k = 0; k < size; ++k) {
+            T *row = base + k * stride;
+            for (long b = 0; b < width; ++b)
+              row[b] = lanes[b * size + k];
+          }
+        }
+      };
+
+      template <class T, size_t N, class K>
+      void for_each_lane(types::ndarray<T, N> &arr, long axis,
+                         K const &kernel)
+      {
+        while (axis < 0)
+          axis += N;
+        axis = axis % N;
+        auto &&shape = arr.shape();
+        long const size = shape[axis];
+        long const stride =
+            std::accumulate(shape.begin() + axis + 1, shape.end(), 1L,
+                            std::multiplies<long>());
+        long const outer =
+            std::accumulate(shape.begin(), shape.begin() + axis, 1L,
+                            std::multiplies<long>());
+        if (size == 0 or stride == 0 or outer == 0)
+          return;
+        long const blocks =
+            (stride + PYTHRAN_SORT_LANE_BLOCK - 1) / PYTHRAN_SORT_LANE_BLOCK;
+        long const units = stride == 1 ? outer : outer * blocks;
+        lane_walker<T> const walker{arr.buffer, size, stride, blocks};
+
+#ifdef _OPENMP
+        if (units > 1 and
+            outer * size * stride >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT) {
+#pragma omp parallel
+          {
+            K local(kernel);
+            scratch_buffer<T> scratch;
+#pragma omp for schedule(dynamic)
+            for (long unit = 0; unit < units; ++unit)
+              walker(unit, local, scratch);
+          }
+          return;
+        }
+#endif
+        K local(kernel);
+        scratch_buffer<T> scratch;
+        for (long unit = 0; unit < units; ++unit)
+          walker(unit, local, scratch);
+      }
+
+      template <class T>
+      struct sort_kernel {
+        sorter<T> s;
+        void operator()(T *first, T *last, long)
+        {
+          s.sort(first, last);
+        }
+      };
+    }
+
+    template <class T, size_t N>
+    void _sort(types::ndarray<T, N> &out, long axis)
+    {
+      details::for_each_lane(out, axis, details::sort_kernel<T>{});
     }
 
     template <class T, size_t N>
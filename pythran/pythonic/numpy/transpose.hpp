@@ -6,6 +6,7 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/numpy_conversion.hpp"
 #include "pythonic/utils/nested_container.hpp"
+#include "pythonic/utils/blocked_transpose.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/__builtin__/ValueError.hpp"
 
@@ -32,25 +33,7 @@ namespace pythonic
         shp[i] = shape[l[i]];
 
       types::ndarray<T, N> new_array(shp, __builtin__::None);
-
-      types::array<long, N> new_strides;
-      new_strides[N - 1] = 1;
-      std::transform(new_strides.rbegin(), new_strides.rend() - 1, shp.rbegin(),
-                     new_strides.rbegin() + 1, std::multiplies<long>());
-
-      types::array<long, N> old_strides;
-      old_strides[N - 1] = 1;
-      std::transform(old_strides.rbegin(), old_strides.rend() - 1,
-                     shape.rbegin(), old_strides.rbegin() + 1,
-                     std::multiplies<long>());
-
-      auto iter = a.buffer, iter_end = a.buffer + a.flat_size();
-      for (long i = 0; iter != iter_end; ++iter, ++i) {
-        long offset = 0;
-        for (unsigned long s = 0; s < N; s++)
-          offset += ((i / old_strides[l[s]]) % shape[l[s]]) * new_strides[s];
-        new_array.buffer[offset] = *iter;
-      }
+      utils::permute_axes(a.buffer, shape, l, new_array.buffer);
 
       return new_array;
     }
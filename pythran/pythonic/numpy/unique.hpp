@@ -6,101 +6,129 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/types/ndarray.hpp"
 #include "pythonic/types/tuple.hpp"
+#include "pythonic/numpy/sort.hpp"
 
-#include <set>
+#include <algorithm>
 
 namespace pythonic
 {
 
   namespace numpy
   {
-    template <class I, class O>
-    void _unique1(I begin, I end, O &out, utils::int_<1>)
+    namespace details
     {
-      out.insert(begin, end);
-    }
+      template <class I, class T>
+      void unique_flatten(I begin, I end, T *&out, utils::int_<1>)
+      {
+        out = std::copy(begin, end, out);
+      }
 
-    template <class I, class O, size_t N>
-    void _unique1(I begin, I end, O &out, utils::int_<N>)
-    {
-      for (; begin != end; ++begin)
-        _unique1((*begin).begin(), (*begin).end(), out, utils::int_<N - 1>());
-    }
+      template <class I, class T, size_t N>
+      void unique_flatten(I begin, I end, T *&out, utils::int_<N>)
+      {
+        for (; begin != end; ++begin)
+          unique_flatten((*begin).begin(), (*begin).end(), out,
+                         utils::int_<N - 1>());
+      }
 
-    template <class E>
-    types::ndarray<typename E::dtype, 1> unique(E const &expr)
-    {
-      std::set<typename E::dtype> res;
-      _unique1(expr.begin(), expr.end(), res, utils::int_<E::value>());
-      return types::ndarray<typename E::dtype, 1>(res);
-    }
+      template <class T>
+      bool unique_equal(T const &self, T const &other)
+      {
+        return self == other or (self != self and other != other);
+      }
 
-    template <class I, class O0, class O1>
-    void _unique2(I begin, I end, O0 &out0, O1 &out1, long &i, utils::int_<1>)
-    {
-      for (; begin != end; ++begin, ++i) {
-        auto pair = out0.insert(*begin);
-        if (pair.second)
-          out1.push_back(i);
+      template <class E>
+      types::ndarray<typename E::dtype, 1> unique_copy(E const &expr)
+      {
+        types::ndarray<typename E::dtype, 1> values(
+            types::array<long, 1>{{expr.flat_size()}}, __builtin__::None);
+        typename E::dtype *iter = values.buffer;
+        unique_flatten(expr.begin(), expr.end(), iter,
+                       utils::int_<E::value>());
+        return values;
+      }
+
+      template <class E>
+      std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
+                 types::ndarray<long, 1>, types::ndarray<long, 1>>
+      unique(E const &expr)
+      {
+        using T = typename E::dtype;
+        types::ndarray<T, 1> values = unique_copy(expr);
+        long const n = values.flat_size();
+        T *sorted = values.buffer;
+
+        types::ndarray<long, 1> inverse(types::array<long, 1>{{n}},
+                                        __builtin__::None);
+        // a stable sort keeps the first occurrence of each value first
+        scratch_buffer<long> buffer;
+        long *order = buffer.get(n);
+        sorter<T>{}.argsort(sorted, sorted + n, order);
+
+        long m = n ? 1 : 0;
+        for (long k = 1; k < n; ++k)
+          m += not unique_equal(sorted[k - 1], sorted[k]);
+
+        types::ndarray<T, 1> uniques(types::array<long, 1>{{m}},
+                                     __builtin__::None);
+        types::ndarray<long, 1> index(types::array<long, 1>{{m}},
+                                      __builtin__::None);
+        types::ndarray<long, 1> counts(types::array<long, 1>{{m}},
+                                       __builtin__::None);
+        long g = -1;
+        for (long k = 0; k < n; ++k) {
+          if (k == 0 or not unique_equal(sorted[k - 1], sorted[k])) {
+            ++g;
+            uniques.buffer[g] = sorted[k];
+            index.buffer[g] = order[k];
+            counts.buffer[g] = 0;
+          }
+          ++counts.buffer[g];
+          inverse.buffer[order[k]] = g;
+        }
+        return std::make_tuple(uniques, index, inverse, counts);
       }
     }
 
-    template <class I, class O0, class O1, size_t N>
-    void _unique2(I begin, I end, O0 &out0, O1 &out1, long &i, utils::int_<N>)
+    template <class E>
+    types::ndarray<typename E::dtype, 1> unique(E const &expr)
     {
-      for (; begin != end; ++begin)
-        _unique2((*begin).begin(), (*begin).end(), out0, out1, i,
-                 utils::int_<N - 1>());
+      using T = typename E::dtype;
+      types::ndarray<T, 1> values = details::unique_copy(expr);
+      T *first = values.buffer, *last = values.buffer + values.flat_size();
+      details::sorter<T>{}.sort(first, last);
+      last = std::unique(first, last, details::unique_equal<T>);
+      types::ndarray<T, 1> out(types::array<long, 1>{{last - first}},
+                               __builtin__::None);
+      std::copy(first, last, out.buffer);
+      return out;
     }
 
     template <class E>
     std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>>
     unique(E const &expr, bool return_index)
     {
-      std::set<typename E::dtype> res;
-      std::vector<long> return_index_res;
-      long i = 0;
-      _unique2(expr.begin(), expr.end(), res, return_index_res, i,
-               utils::int_<E::value>());
-      return std::make_tuple(types::ndarray<typename E::dtype, 1>(res),
-                             types::ndarray<long, 1>(return_index_res));
+      auto res = details::unique(expr);
+      return std::make_tuple(std::get<0>(res), std::get<1>(res));
     }
 
-    template <class I, class O0, class O1, class O2>
-    void _unique3(I begin, I end, O0 &out0, O1 &out1, O2 &out2, long &i,
-                  utils::int_<1>)
-    {
-      for (; begin != end; ++begin, ++i) {
-        auto pair = out0.insert(*begin);
-        out2[i] = std::distance(out0.begin(), pair.first);
-        if (pair.second)
-          out1.push_back(i);
-      }
-    }
-    template <class I, class O0, class O1, class O2, size_t N>
-    void _unique3(I begin, I end, O0 &out0, O1 &out1, O2 &out2, long &i,
-                  utils::int_<N>)
+    template <class E>
+    std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
+               types::ndarray<long, 1>>
+    unique(E const &expr, bool return_index, bool return_inverse)
     {
-      for (; begin != end; ++begin)
-        _unique3((*begin).begin(), (*begin).end(), out0, out1, out2, i,
-                 utils::int_<N - 1>());
+      auto res = details::unique(expr);
+      return std::make_tuple(std::get<0>(res), std::get<1>(res),
+                             std::get<2>(res));
     }
 
     template <class E>
     std::tuple<types::ndarray<typename E::dtype, 1>, types::ndarray<long, 1>,
-               types::ndarray<long, 1>>
-    unique(E const &expr, bool return_index, bool return_inverse)
+               types::ndarray<long, 1>, types::ndarray<long, 1>>
+    unique(E const &expr, bool return_index, bool return_inverse,
+           bool return_counts)
     {
-      std::set<typename E::dtype> res;
-      std::vector<long> return_index_res;
-      types::ndarray<long, 1> return_inverse_res(
-          types::array<long, 1>{{expr.flat_size()}}, __builtin__::None);
-      long i = 0;
-      _unique3(expr.begin(), expr.end(), res, return_index_res,
-               return_inverse_res, i, utils::int_<E::value>());
-      return std::make_tuple(types::ndarray<typename E::dtype, 1>(res),
-                             types::ndarray<long, 1>(return_index_res),
-                             return_inverse_res);
+      return details::unique(expr);
     }
 
     DEFINE_FUNCTOR(pythonic::numpy, unique)
@@ -14,6 +14,39 @@ namespace pythonic
 
   template <class T>
   struct from_python;
+
+  /* Releases the GIL for its lifetime, so that other Python threads run
+   * while a kernel computes. The GIL is reacquired on destruction, which
+   * also happens during stack unwinding, so exceptions are always
+   * translated with the GIL held.
+   */
+  class gil_release
+  {
+    PyThreadState *state_;
+
+  public:
+    gil_release() : state_(PyEval_SaveThread())
+    {
+    }
+    gil_release(gil_release const &) = delete;
+    gil_release &operator=(gil_release const &) = delete;
+    ~gil_release()
+    {
+      PyEval_RestoreThread(state_);
+    }
+  };
+
+  /* Calls ``f'' without holding the GIL. ``f'' must not touch Python
+   * objects, which is the case of pythran functions: their arguments have
+   * already been converted and are kept alive by the caller.
+   */
+  template <class F, class... Args>
+  auto call_without_gil(F &&f, Args &&... args)
+      -> decltype(std::forward<F>(f)(std::forward<Args>(args)...))
+  {
+    gil_release nogil;
+    return std::forward<F>(f)(std::forward<Args>(args)...);
+  }
 }
 
 template <class T>
@@ -0,0 +1,141 @@
+#ifndef PYTHONIC_PYTHON_DISPATCH_HPP
+#define PYTHONIC_PYTHON_DISPATCH_HPP
+
+#ifdef ENABLE_PYTHON_MODULE
+
+#include "Python.h"
+#include <cstddef>
+#include <cstdint>
+
+/* Exported functions receive their arguments as a C array when the
+ * interpreter supports it, which avoids building a tuple for each call.
+ */
+#if PY_VERSION_HEX >= 0x03070000
+#define PYTHRAN_FASTCALL 1
+#define PYTHRAN_METH_ARGS METH_FASTCALL
+#else
+#define PYTHRAN_FASTCALL 0
+#define PYTHRAN_METH_ARGS METH_VARARGS
+#endif
+
+namespace pythonic
+{
+
+  namespace python
+  {
+
+    /* Cheap hash of the types of a call arguments: their type object and,
+     * for arrays, their dtype, number of dimensions and memory layout.
+     *
+     * Overloads accept or reject two calls with the same fingerprint alike,
+     * so it is enough to know which one to call. That does not hold for
+     * containers, whose conversion depends on their content: 0 is returned
+     * if any argument is a container.
+     */
+    inline size_t type_fingerprint(PyObject *const *args, Py_ssize_t nargs)
+    {
+      size_t seed = nargs;
+      for (Py_ssize_t i = 0; i < nargs; ++i) {
+        PyObject *obj = args[i];
+        if (PyList_Check(obj) or PyTuple_Check(obj) or PyDict_Check(obj) or
+            PyAnySet_Check(obj))
+          return 0;
+        size_t hash = reinterpret_cast<uintptr_t>(Py_TYPE(obj));
+#if PY_MAJOR_VERSION >= 3
+        if (PyUnicode_Check(obj))
+          hash ^= PyUnicode_IS_ASCII(obj);
+#endif
+#ifdef PYTHONIC_TYPES_NDARRAY_HPP
+        if (PyArray_Check(obj)) {
+          // the layout properties checked by from_python
+          PyArrayObject *arr = reinterpret_cast<PyArrayObject *>(obj);
+          long const ndim = PyArray_NDIM(arr);
+          auto const *strides = PyArray_STRIDES(arr);
+          auto const *dims = PyArray_DIMS(arr);
+          long const itemsize = PyArray_ITEMSIZE(arr);
+          bool c_strides = true, f_strides = true, aligned = true;
+          for (long j = 0, c = itemsize, f = itemsize; j < ndim; ++j) {
+            c_strides &= strides[ndim - 1 - j] == c;
+            c *= dims[ndim - 1 - j];
+            f_strides &= strides[j] == f;
+            f *= dims[j];
+            aligned &= strides[j] % itemsize == 0;
+          }
+          size_t layout =
+              c_strides | (f_strides << 1) | (aligned << 2) |
+              (bool(PyArray_FLAGS(arr) & NPY_ARRAY_F_CONTIGUOUS) << 3);
+          hash ^= (size_t(PyArray_TYPE(arr)) << 4) ^ (size_t(ndim) << 12) ^
+                  (layout << 20);
+        }
+#endif
+        seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+      return seed;
+    }
+
+    /* Remembers which overload of a function matched a given fingerprint,
+     * so that later calls try it first instead of checking each overload in
+     * turn. Direct mapped: a collision just replaces the previous entry.
+     *
+     * Only accessed while holding the GIL.
+     */
+    template <size_t N>
+    class dispatch_cache
+    {
+      struct entry {
+        size_t fingerprint;
+        long overload;
+      };
+      entry entries_[N];
+
+    public:
+      dispatch_cache()
+      {
+        for (entry &e : entries_)
+          e = {0, -1};
+      }
+
+      // index of the overload matching ``fingerprint'', or -1 if unknown
+      long find(size_t fingerprint) const
+      {
+        entry const &e = entries_[fingerprint % N];
+        return e.fingerprint == fingerprint ? e.overload : -1;
+      }
+
+      void update(size_t fingerprint, long overload)
+      {
+        entries_[fingerprint % N] = {fingerprint, overload};
+      }
+    };
+
+    /* Calls the first overload in ``overloads'' that accepts ``args''.
+     * Overloads return nullptr when they do not accept the arguments.
+     */
+    template <size_t N, size_t M>
+    PyObject *dispatch(dispatch_cache<N> &cache,
+                       PyObject *(*const(&overloads)[M])(PyObject *const *,
+                                                         Py_ssize_t),
+                       PyObject *const *args, Py_ssize_t nargs)
+    {
+      size_t fingerprint = type_fingerprint(args, nargs);
+      long hint = fingerprint ? cache.find(fingerprint) : -1;
+      if (hint >= 0)
+        if (PyObject *obj = overloads[hint](args, nargs))
+          return obj;
+      for (long i = 0; i < long(M); ++i) {
+        if (i == hint)
+          continue;
+        if (PyObject *obj = overloads[i](args, nargs)) {
+          if (fingerprint)
+            cache.update(fingerprint, i);
+          return obj;
+        }
+      }
+      return nullptr;
+    }
+  }
+}
+
+#endif
+
+#endif
@@ -13,7 +13,7 @@ namespace pythonic
   {
     double expovariate(double l)
     {
-      return std::exponential_distribution<>(l)(__random_generator);
+      return std::exponential_distribution<>(l)(__random_generator());
     }
 
     DEFINE_FUNCTOR(pythonic::random, expovariate);
@@ -14,7 +14,7 @@ namespace pythonic
 
     double gauss(double mu, double sigma)
     {
-      return std::normal_distribution<>(mu, sigma)(__random_generator);
+      return std::normal_distribution<>(mu, sigma)(__random_generator());
     }
 
     DEFINE_FUNCTOR(pythonic::random, gauss);
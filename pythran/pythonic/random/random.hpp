@@ -4,6 +4,7 @@
 #include "pythonic/include/random/random.hpp"
 
 #include "pythonic/utils/functor.hpp"
+#include "pythonic/utils/philox.hpp"
 #include <random>
 
 namespace pythonic
@@ -12,10 +13,16 @@ namespace pythonic
   namespace random
   {
 
+    utils::philox4x32 &__random_generator()
+    {
+      static thread_local utils::thread_random local;
+      local.sync(details::state);
+      return local.generator;
+    }
+
     double random()
     {
-      static std::uniform_real_distribution<> uniform_distrib(0.0, 1.0);
-      return uniform_distrib(__random_generator);
+      return std::uniform_real_distribution<>(0.0, 1.0)(__random_generator());
     }
 
     DEFINE_FUNCTOR(pythonic::random, random);
@@ -16,13 +16,13 @@ namespace pythonic
   {
     types::none_type seed(long s)
     {
-      __random_generator.seed(s);
+      details::state.reseed(s);
       return __builtin__::None;
     }
 
     types::none_type seed()
     {
-      __random_generator.seed(time(nullptr));
+      details::state.reseed(time(nullptr));
       return __builtin__::None;
     }
 
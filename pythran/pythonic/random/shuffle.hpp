@@ -17,7 +17,7 @@ namespace pythonic
     template <class T>
     void shuffle(T &seq)
     {
-      std::shuffle(seq.begin(), seq.end(), __random_generator);
+      std::shuffle(seq.begin(), seq.end(), __random_generator());
     }
 
     namespace details
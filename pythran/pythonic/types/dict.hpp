@@ -7,6 +7,7 @@
 #include "pythonic/types/empty_iterator.hpp"
 #include "pythonic/utils/iterator.hpp"
 #include "pythonic/utils/reserve.hpp"
+#include "pythonic/utils/flat_hash_table.hpp"
 #include "pythonic/__builtin__/None.hpp"
 #include "pythonic/utils/shared_ref.hpp"
 
@@ -15,7 +16,9 @@
 #include <limits>
 #include <algorithm>
 #include <iterator>
+#ifdef PYTHRAN_DICT_USE_BOOST_UNORDERED
 #include <boost/unordered_map.hpp>
+#endif
 
 namespace pythonic
 {
@@ -18,8 +18,12 @@
 #include <iterator>
 #include <cstring>
 #include <string>
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 namespace pythonic
 {
@@ -29,14 +33,35 @@ namespace pythonic
 
     /// _file implementation
 
-    _file::_file() : f(nullptr)
+    _file::_file()
+        : f(nullptr), map(nullptr), map_size(0), map_pos(0), line(nullptr),
+          line_capacity(0)
     {
     }
 
     // TODO : no check on file existance?
     _file::_file(types::str const &filename, types::str const &strmode)
-        : f(fopen(filename.c_str(), strmode.c_str()))
-    {
+        : f(fopen(filename.c_str(), strmode.c_str())), map(nullptr),
+          map_size(0), map_pos(0), line(nullptr), line_capacity(0)
+    {
+      if (not f or strmode.find_first_of("wa+") != -1)
+        return;
+#ifdef PYTHRAN_FILE_MMAP
+      struct stat st;
+      if (fstat(::fileno(f), &st) == 0 and S_ISREG(st.st_mode) and
+          st.st_size > 0) {
+        void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE,
+                          ::fileno(f), 0);
+        if (addr != MAP_FAILED) {
+          madvise(addr, st.st_size, MADV_SEQUENTIAL);
+          map = static_cast<char const *>(addr);
+          map_size = st.st_size;
+          return;
+        }
+      }
+#endif
+      // other files go through large stdio reads
+      setvbuf(f, nullptr, _IOFBF, 1 << 16);
     }
 
     FILE *_file::operator*() const
@@ -44,10 +69,22 @@ namespace pythonic
       return f;
     }
 
-    _file::~_file()
+    void _file::close()
     {
+      if (map)
+        munmap(const_cast<char *>(map), map_size);
+      map = nullptr;
+      free(line);
+      line = nullptr;
+      line_capacity = 0;
       if (f)
         fclose(f);
+      f = nullptr;
+    }
+
+    _file::~_file()
+    {
+      close();
     }
 
     /// file implementation
@@ -93,8 +130,7 @@ namespace pythonic
 
     void file::close()
     {
-      fclose(**data);
-      data->f = nullptr;
+      data->close();
       is_open = false;
     }
 
@@ -122,6 +158,8 @@ namespace pythonic
 
     bool file::eof()
     {
+      if (data->map)
+        return data->map_pos >= data->map_size;
       return ::feof(**data);
     }
 
@@ -150,30 +188,35 @@ namespace pythonic
     {
       if (not is_open)
         throw ValueError("I/O operation on closed file");
-      if (feof(**data) && mode.find_first_of("ra") == -1)
+      if (eof() && mode.find_first_of("ra") == -1)
         // If we are at eof on reading mode throw exception
         throw StopIteration("file.next() : EOF reached.");
       return readline();
     }
 
-    types::str file::read(int size)
+    types::str file::read(long size)
     {
       if (not is_open)
         throw ValueError("I/O operation on closed file");
       if (mode.find_first_of("r+") == -1)
         throw IOError("File not open for reading");
+      if (data->map) {
+        long n = std::max(0L, data->map_size - data->map_pos);
+        if (size >= 0)
+          n = std::min<long>(size, n);
+        types::str res(data->map + data->map_pos, n);
+        data->map_pos += n;
+        return res;
+      }
       if (size == 0 or (feof(**data) && mode.find_first_of("ra") == -1))
         return types::str();
-      int curr_pos = tell();
+      long curr_pos = tell();
       seek(0, SEEK_END);
-      size = size < 0 ? tell() - curr_pos : size;
+      size = size < 0 ? std::max(0L, tell() - curr_pos) : size;
       seek(curr_pos);
-      char *content = new char[size + 1];
-      // This part needs a new implementation of types::str(char*) to avoid
-      // unnecessary copy.
-      types::str res(content, fread(content, sizeof(char), size, **data));
-      delete[] content;
-      return res;
+      std::string content(size, '\0');
+      content.resize(fread(&content[0], sizeof(char), size, **data));
+      return {std::move(content)};
     }
 
     types::str file::readline(long size)
@@ -182,6 +225,25 @@ namespace pythonic
         throw ValueError("I/O operation on closed file");
       if (mode.find_first_of("r+") == -1)
         throw IOError("File not open for reading");
+      if (data->map) {
+        char const *start = data->map + data->map_pos;
+        long n = std::min(size, std::max(0L, data->map_size - data->map_pos));
+        if (n <= 0)
+          return types::str();
+        auto eol = static_cast<char const *>(memchr(start, '\n', n));
+        if (eol)
+          n = eol - start + 1;
+        data->map_pos += n;
+        return types::str(start, n);
+      }
+      if (size == std::numeric_limits<long>::max()) {
+        // getline scans the stdio buffer with memchr, then the line is
+        // copied once
+        ssize_t n = ::getline(&data->line, &data->line_capacity, **data);
+        if (n <= 0)
+          return types::str();
+        return types::str(data->line, n);
+      }
       constexpr static long BUFFER_SIZE = 1024;
       types::str res;
       char read_str[BUFFER_SIZE];
@@ -207,23 +269,31 @@ namespace pythonic
       return lst;
     }
 
-    void file::seek(int offset, int whence)
+    void file::seek(long offset, int whence)
     {
       if (not is_open)
         throw ValueError("I/O operation on closed file");
       if (whence != SEEK_SET && whence != SEEK_CUR && whence != SEEK_END)
         throw IOError("file.seek() :  Invalid argument.");
-      fseek(**data, offset, whence);
+      if (data->map) {
+        long base = whence == SEEK_SET
+                        ? 0
+                        : whence == SEEK_CUR ? data->map_pos : data->map_size;
+        data->map_pos = std::max(0L, base + offset);
+      } else
+        fseek(**data, offset, whence);
     }
 
-    int file::tell() const
+    long file::tell() const
     {
       if (not is_open)
         throw ValueError("I/O operation on closed file");
+      if (data->map)
+        return data->map_pos;
       return ftell(**data);
     }
 
-    void file::truncate(int size)
+    void file::truncate(long size)
     {
       if (not is_open)
         throw ValueError("I/O operation on closed file");
@@ -242,7 +312,7 @@ namespace pythonic
         throw ValueError("I/O operation on closed file");
       if (mode.find_first_of("wa+") == -1)
         throw IOError("file.write() :  File not opened for writing.");
-      fwrite(str.c_str(), sizeof(char), str.size(), **data);
+      fwrite(str.chars(), sizeof(char), str.size(), **data);
     }
 
     template <class T>
@@ -258,8 +328,10 @@ namespace pythonic
     // Like in :
     // for line in open("myfile"):
     //     print line
+    // Lines are never empty, but for the one read at end of file, so the
+    // position is a line counter that becomes -1 once the end is reached.
     file_iterator::file_iterator(file &ref)
-        : f(ref), curr(ref.readline()), position(ref.tell())
+        : f(ref), curr(ref.readline()), position(curr ? 0 : -1)
     {
     }
 
@@ -285,11 +357,10 @@ namespace pythonic
 
     file_iterator &file_iterator::operator++()
     {
-      // Check if ftell == -1 when fgetpos(FILE *stream, fpos_t eof) == 0
-      if (f.eof())
+      if (position == -1)
         return *this;
       curr = f.readline();
-      position = f.eof() ? -1 : f.tell();
+      position = curr ? position + 1 : -1;
       return *this;
     }
 
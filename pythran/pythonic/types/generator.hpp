@@ -27,8 +27,10 @@ namespace pythonic
     template <class T>
     generator_iterator<T> &generator_iterator<T>::operator++()
     {
+      // the generator flags its end itself, StopIteration only comes from
+      // its body, which it ends as in Python 2
       try {
-        the_generator.next();
+        the_generator.__generator_step();
       } catch (types::StopIteration const &) {
         the_generator.__generator_state = -1;
       }
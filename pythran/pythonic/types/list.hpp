@@ -73,15 +73,29 @@ namespace pythonic
 
     // accessor
     template <class T, class S>
-    T const &sliced_list<T, S>::operator[](long i) const
+    T const &sliced_list<T, S>::fast(long i) const
     {
       return (*data)[slicing.get(i)];
     }
     template <class T, class S>
-    T &sliced_list<T, S>::operator[](long i)
+    T &sliced_list<T, S>::fast(long i)
     {
       return (*data)[slicing.get(i)];
     }
+    template <class T, class S>
+    T const &sliced_list<T, S>::operator[](long i) const
+    {
+      if (i < 0)
+        i += size();
+      return fast(i);
+    }
+    template <class T, class S>
+    T &sliced_list<T, S>::operator[](long i)
+    {
+      if (i < 0)
+        i += size();
+      return fast(i);
+    }
 
     // comparison
     template <class T, class S>
@@ -565,6 +579,11 @@ namespace pythonic
       return data->size();
     }
     template <class T>
+    bool list<T>::unique() const
+    {
+      return data.unique();
+    }
+    template <class T>
     template <class E>
     long list<T>::_flat_size(E const &e, utils::int_<1>) const
     {
@@ -39,6 +39,7 @@
 #include "pythonic/types/numpy_texpr.hpp"
 #include "pythonic/types/numpy_iexpr.hpp"
 #include "pythonic/types/numpy_gexpr.hpp"
+#include "pythonic/types/numpy_sexpr.hpp"
 #include "pythonic/utils/numpy_traits.hpp"
 
 #include "pythonic/__builtin__/len.hpp"
@@ -243,6 +244,22 @@ namespace pythonic
       return std::forward<A>(self)[indices[M - 1]];
     }
 
+    template <size_t L>
+    template <class A, size_t M>
+    auto nfast<L>::operator()(A &&self, array<long, M> const &indices)
+        -> decltype(nfast<L - 1>()(std::forward<A>(self).fast(0), indices))
+    {
+      return nfast<L - 1>()(std::forward<A>(self).fast(indices[M - L - 1]),
+                            indices);
+    }
+
+    template <class A, size_t M>
+    auto nfast<0>::operator()(A &&self, array<long, M> const &indices)
+        -> decltype(std::forward<A>(self).fast(indices[M - 1]))
+    {
+      return std::forward<A>(self).fast(indices[M - 1]);
+    }
+
     template <size_t L>
     template <size_t M>
     long noffset<L>::operator()(array<long, M> const &shape,
@@ -389,6 +406,14 @@ namespace pythonic
       initialize_from_expr(expr);
     }
 
+    template <class T, size_t N>
+    template <class Tp>
+    ndarray<T, N>::ndarray(numpy_sexpr<Tp, N> const &expr)
+        : mem(expr.flat_size()), buffer(mem->data), _shape(expr.shape())
+    {
+      initialize_from_expr(expr);
+    }
+
     /* update operators */
 
     template <class T, size_t N>
@@ -500,17 +525,49 @@ namespace pythonic
     }
 
     template <class T, size_t N>
-    T const &ndarray<T, N>::operator[](array<long, N> const &indices) const
+    T const &ndarray<T, N>::fast(array<long, N> const &indices) const
     {
       return *(buffer + noffset<N - 1>{}(_shape, indices));
     }
 
     template <class T, size_t N>
-    T &ndarray<T, N>::operator[](array<long, N> const &indices)
+    T &ndarray<T, N>::fast(array<long, N> const &indices)
     {
       return *(buffer + noffset<N - 1>{}(_shape, indices));
     }
 
+    template <class T, size_t N>
+    template <size_t M>
+    auto ndarray<T, N>::fast(array<long, M> const &indices) const
+        & -> decltype(nfast<M - 1>()(*this, indices))
+    {
+      return nfast<M - 1>()(*this, indices);
+    }
+
+    template <class T, size_t N>
+        template <size_t M>
+        auto ndarray<T, N>::fast(array<long, M> const &indices) &&
+        -> decltype(nfast<M - 1>()(std::move(*this), indices))
+    {
+      return nfast<M - 1>()(std::move(*this), indices);
+    }
+
+    template <class T, size_t N>
+    T const &ndarray<T, N>::operator[](array<long, N> const &indices) const
+    {
+      array<long, N> positive_indices;
+      for (size_t i = 0; i < N; ++i)
+        positive_indices[i] =
+            indices[i] < 0 ? indices[i] + _shape[i] : indices[i];
+      return fast(positive_indices);
+    }
+
+    template <class T, size_t N>
+    T &ndarray<T, N>::operator[](array<long, N> const &indices)
+    {
+      return const_cast<T &>(const_cast<ndarray const &>(*this)[indices]);
+    }
+
     template <class T, size_t N>
     template <size_t M>
     auto ndarray<T, N>::operator[](array<long, M> const &indices) const
@@ -1065,6 +1122,90 @@ namespace pythonic
         auto ta = getattr<attr::IMAG, E>{}(a.arg);
         return types::numpy_texpr<decltype(ta)>{ta};
       }
+
+      template <class T, size_t N>
+      array<long, N> getattr<attr::STRIDES, types::numpy_sexpr<T, N>>::
+      operator()(types::numpy_sexpr<T, N> const &a)
+      {
+        array<long, N> strides;
+        for (size_t i = 0; i < N; ++i)
+          strides[i] = a._strides[i] * sizeof(T);
+        return strides;
+      }
+
+      namespace
+      {
+        // view on the real (offset = 0) or imaginary (offset = 1) part of a
+        // complex strided view
+        template <class T, size_t N>
+        types::numpy_sexpr<typename types::is_complex<T>::type, N>
+        make_complex_part(types::numpy_sexpr<T, N> const &a, long offset)
+        {
+          using stype = typename types::is_complex<T>::type;
+          array<long, N> strides;
+          for (size_t i = 0; i < N; ++i)
+            strides[i] = 2 * a._strides[i];
+          // same trick as for arrays, see getattr<attr::REAL, E>
+          auto const &translated_mem =
+              reinterpret_cast<utils::shared_ref<raw_array<stype>> const &>(
+                  a.mem);
+          return {translated_mem,
+                  reinterpret_cast<stype *>(a.buffer) + offset, a.shape(),
+                  strides};
+        }
+      }
+
+      template <class T, size_t N>
+      types::numpy_sexpr<T, N>
+      getattr<attr::REAL, types::numpy_sexpr<T, N>>::make_part(
+          types::numpy_sexpr<T, N> const &a, utils::int_<0>)
+      {
+        return a;
+      }
+
+      template <class T, size_t N>
+      types::numpy_sexpr<typename getattr<attr::REAL,
+                                          types::numpy_sexpr<T, N>>::stype,
+                         N>
+      getattr<attr::REAL, types::numpy_sexpr<T, N>>::make_part(
+          types::numpy_sexpr<T, N> const &a, utils::int_<1>)
+      {
+        return make_complex_part(a, 0);
+      }
+
+      template <class T, size_t N>
+      auto getattr<attr::REAL, types::numpy_sexpr<T, N>>::
+      operator()(types::numpy_sexpr<T, N> const &a) -> decltype(
+          this->make_part(a, utils::int_<types::is_complex<T>::value>{}))
+      {
+        return make_part(a, utils::int_<types::is_complex<T>::value>{});
+      }
+
+      template <class T, size_t N>
+      types::ndarray<T, N>
+      getattr<attr::IMAG, types::numpy_sexpr<T, N>>::make_part(
+          types::numpy_sexpr<T, N> const &a, utils::int_<0>)
+      {
+        return {a.shape(), T(0)};
+      }
+
+      template <class T, size_t N>
+      types::numpy_sexpr<typename getattr<attr::IMAG,
+                                          types::numpy_sexpr<T, N>>::stype,
+                         N>
+      getattr<attr::IMAG, types::numpy_sexpr<T, N>>::make_part(
+          types::numpy_sexpr<T, N> const &a, utils::int_<1>)
+      {
+        return make_complex_part(a, 1);
+      }
+
+      template <class T, size_t N>
+      auto getattr<attr::IMAG, types::numpy_sexpr<T, N>>::
+      operator()(types::numpy_sexpr<T, N> const &a) -> decltype(
+          this->make_part(a, utils::int_<types::is_complex<T>::value>{}))
+      {
+        return make_part(a, utils::int_<types::is_complex<T>::value>{});
+      }
     }
   }
   namespace __builtin__
@@ -1110,6 +1251,13 @@ namespace pythonic
     {
       return types::__ndarray::getattr<I, types::numpy_texpr<A>>()(f);
     }
+
+    template <int I, class T, size_t N>
+    auto getattr(types::numpy_sexpr<T, N> const &f) -> decltype(
+        types::__ndarray::getattr<I, types::numpy_sexpr<T, N>>()(f))
+    {
+      return types::__ndarray::getattr<I, types::numpy_sexpr<T, N>>()(f);
+    }
   }
 }
 
@@ -1308,6 +1456,13 @@ namespace pythonic
                        types::numpy_gexpr<Arg, S...>::value>{v});
   }
 
+  template <class T, size_t N>
+  PyObject *to_python<types::numpy_sexpr<T, N>>::convert(
+      types::numpy_sexpr<T, N> const &v)
+  {
+    return ::to_python(types::ndarray<T, N>{v});
+  }
+
   namespace impl
   {
     template <typename T, size_t N>
@@ -1323,29 +1478,6 @@ namespace pythonic
         return nullptr;
       return arr;
     }
-
-    template <class T, class S>
-    std::tuple<types::slice> make_slices(long const *strides,
-                                         long const *offsets, S const *dims,
-                                         utils::int_<1>)
-    {
-      return std::tuple<types::slice>(types::slice(
-          *offsets, *offsets + *dims * *strides, *strides / sizeof(T)));
-    }
-
-    template <class T, class S, size_t N>
-    auto make_slices(long const *strides, long const *offsets, S const *dims,
-                     utils::int_<N>)
-        -> decltype(std::tuple_cat(
-            make_slices<T>(strides, offsets, dims, utils::int_<1>()),
-            make_slices<T>(strides + 1, offsets + 1, dims + 1,
-                           utils::int_<N - 1>())))
-    {
-      return std::tuple_cat(
-          make_slices<T>(strides, offsets, dims, utils::int_<1>()),
-          make_slices<T>(strides + 1, offsets + 1, dims + 1,
-                         utils::int_<N - 1>()));
-    }
   }
 
   template <typename T, size_t N>
@@ -1377,91 +1509,38 @@ namespace pythonic
     return r;
   }
 
-  template <typename T, size_t N, class... S>
-  bool
-  from_python<types::numpy_gexpr<types::ndarray<T, N>, S...>>::is_convertible(
-      PyObject *obj)
+  template <typename T, size_t N>
+  bool from_python<types::numpy_sexpr<T, N>>::is_convertible(PyObject *obj)
   {
     PyArrayObject *arr = impl::check_array_type_and_dims<T, N>(obj);
     if (not arr)
       return false;
-
-    PyObject *base_obj = PyArray_BASE(arr);
-    if (!base_obj or !PyArray_Check(base_obj))
-      return false;
-    PyArrayObject *base_arr = reinterpret_cast<PyArrayObject *>(base_obj);
-
+    // any layout fits, as long as elements are not split across strides,
+    // which may happen with views on record arrays
     auto const *stride = PyArray_STRIDES(arr);
-    auto const *dims = PyArray_DIMS(arr);
-
-    /* FIXME If we have at least one stride, we convert the whole
-     * array to a numpy_gexpr, without trying to be smarter with
-     * contiguous slices
-     */
-    long current_stride = PyArray_ITEMSIZE(arr);
-    bool at_least_one_stride = false;
-    for (long i = N - 1; i >= 0; i--) {
-      if (stride[i] < 0) {
-        std::cerr << "array with negative strides are not supported"
-                  << std::endl;
-        return false;
-      } else if (stride[i] != current_stride) {
-        at_least_one_stride = true;
-        break;
-      }
-      current_stride *= dims[i];
-    }
-    if (at_least_one_stride) {
-      if (PyArray_NDIM(base_arr) != N) {
-        std::cerr << "reshaped array are not supported" << std::endl;
+    for (size_t i = 0; i < N; ++i)
+      if (stride[i] % (long)sizeof(T))
         return false;
-      }
-      return true;
-    } else
-      return false;
+    return true;
   }
 
-  template <typename T, size_t N, class... S>
-  types::numpy_gexpr<types::ndarray<T, N>, S...>
-  from_python<types::numpy_gexpr<types::ndarray<T, N>, S...>>::convert(
-      PyObject *obj)
+  template <typename T, size_t N>
+  types::numpy_sexpr<T, N>
+  from_python<types::numpy_sexpr<T, N>>::convert(PyObject *obj)
   {
     PyArrayObject *arr = reinterpret_cast<PyArrayObject *>(obj);
-    PyArrayObject *base_arr =
-        reinterpret_cast<PyArrayObject *>(PyArray_BASE(arr));
-
-    /* from the base array pointer and this array pointer, we can recover the
-     * full slice informations
-     * unfortunately, the PyArray representation is different from our.
-     * - PyArray_BYTES gives the start of the base pointer
-     * - PyArray_Dims give the dimension array (the shape)
-     * - PyArray_STRIDES gives the stride information, but relative to the
-     * base
-     * pointer and not relative to the lower dimension
-     */
-    long offsets[N];
-    long strides[N];
-    auto const *base_dims = PyArray_DIMS(base_arr);
-
-    auto full_offset = PyArray_BYTES(arr) - PyArray_BYTES(base_arr);
-    auto const *arr_strides = PyArray_STRIDES(arr);
-    long accumulated_dim = 1;
-    offsets[N - 1] = full_offset % base_dims[N - 1];
-    strides[N - 1] = arr_strides[N - 1];
-    for (ssize_t i = N - 2; i >= 0; --i) {
-      accumulated_dim *= base_dims[i + 1];
-      offsets[i] = full_offset / accumulated_dim;
-      strides[i] = arr_strides[i] / accumulated_dim;
-    }
-
-    types::ndarray<T, N> base_array((T *)PyArray_BYTES(base_arr),
-                                    PyArray_DIMS(base_arr), obj);
-    auto slices = impl::make_slices<T>(strides, offsets, PyArray_DIMS(arr),
-                                       utils::int_<N>());
-    types::numpy_gexpr<types::ndarray<T, N>, S...> r(base_array, slices);
-
+    auto const *dims = PyArray_DIMS(arr);
+    auto const *stride = PyArray_STRIDES(arr);
+    types::array<long, N> shape, strides;
+    for (size_t i = 0; i < N; ++i) {
+      shape[i] = dims[i];
+      strides[i] = stride[i] / (long)sizeof(T);
+    }
+    T *data = (T *)PyArray_BYTES(arr);
+    utils::shared_ref<types::raw_array<T>> mem(data);
+    mem.external(obj); // decref the array at the end of the view lifetime
     Py_INCREF(obj);
-    return r;
+    return {mem, data, shape, strides};
   }
 
   template <typename E>
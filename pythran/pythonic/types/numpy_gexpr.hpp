@@ -768,6 +768,22 @@ namespace pythonic
       return nget<M - 1>()(std::move(*this), indices);
     }
 
+    template <class Arg, class... S>
+    template <size_t M>
+    auto numpy_gexpr<Arg, S...>::fast(array<long, M> const &indices) const
+        & -> decltype(nfast<M - 1>()(*this, indices))
+    {
+      return nfast<M - 1>()(*this, indices);
+    }
+
+    template <class Arg, class... S>
+        template <size_t M>
+        auto numpy_gexpr<Arg, S...>::fast(array<long, M> const &indices) &&
+        -> decltype(nfast<M - 1>()(std::move(*this), indices))
+    {
+      return nfast<M - 1>()(std::move(*this), indices);
+    }
+
     template <class Arg, class... S>
     template <class F>
     typename std::enable_if<is_numexpr_arg<F>::value,
@@ -54,9 +54,11 @@ namespace pythonic
     template <class E>
     numpy_iexpr<Arg> &numpy_iexpr<Arg>::operator=(E const &expr)
     {
-      return utils::broadcast_copy<numpy_iexpr &, E, value,
-                                   value - utils::dim_of<E>::value,
-                                   false /*NIY*/>(*this, expr);
+      return utils::broadcast_copy<
+          numpy_iexpr &, E, value, value - utils::dim_of<E>::value,
+          is_vectorizable and is_vectorizable_array<E>::value and
+              std::is_same<dtype, typename dtype_of<E>::type>::value>(*this,
+                                                                      expr);
     }
 
     template <class Arg>
@@ -64,7 +66,7 @@ namespace pythonic
     {
       return utils::broadcast_copy<numpy_iexpr &, numpy_iexpr const &, value,
                                    value - utils::dim_of<numpy_iexpr>::value,
-                                   false /*NIY*/>(*this, expr);
+                                   is_vectorizable>(*this, expr);
     }
 
     template <class Arg>
@@ -364,17 +366,33 @@ namespace pythonic
       return fast(filter);
     }
 
+    template <class Arg>
+    typename numpy_iexpr<Arg>::dtype const &numpy_iexpr<Arg>::
+    fast(array<long, value> const &indices) const
+    {
+      long offset = indices[0];
+      for (size_t i = 1; i < value; ++i)
+        offset = offset * _shape[i] + indices[i];
+      return buffer[offset];
+    }
+
+    template <class Arg>
+    typename numpy_iexpr<Arg>::dtype &numpy_iexpr<Arg>::
+    fast(array<long, value> const &indices)
+    {
+      return const_cast<dtype &>(
+          const_cast<numpy_iexpr const &>(*this).fast(indices));
+    }
+
     template <class Arg>
     typename numpy_iexpr<Arg>::dtype const &numpy_iexpr<Arg>::
     operator[](array<long, value> const &indices) const
     {
-      size_t offset = indices[value - 1];
-      long mult = _shape[value - 1];
-      for (size_t i = value - 2; i > 0; --i) {
-        offset += indices[i] * mult;
-        mult *= _shape[i];
-      }
-      return buffer[offset + indices[0] * mult];
+      array<long, value> positive_indices;
+      for (size_t i = 0; i < value; ++i)
+        positive_indices[i] =
+            indices[i] < 0 ? indices[i] + _shape[i] : indices[i];
+      return fast(positive_indices);
     }
 
     template <class Arg>
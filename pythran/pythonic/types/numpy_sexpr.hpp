@@ -0,0 +1,415 @@
+#ifndef PYTHONIC_TYPES_NUMPY_SEXPR_HPP
+#define PYTHONIC_TYPES_NUMPY_SEXPR_HPP
+
+#include "pythonic/include/types/numpy_sexpr.hpp"
+
+#include "pythonic/types/ndarray.hpp"
+#include "pythonic/types/nditerator.hpp"
+#include "pythonic/types/slice.hpp"
+#include "pythonic/utils/broadcast_copy.hpp"
+#include "pythonic/operator_/iadd.hpp"
+#include "pythonic/operator_/iand.hpp"
+#include "pythonic/operator_/idiv.hpp"
+#include "pythonic/operator_/imul.hpp"
+#include "pythonic/operator_/ior.hpp"
+#include "pythonic/operator_/isub.hpp"
+
+#include <functional>
+#include <numeric>
+
+namespace pythonic
+{
+
+  namespace types
+  {
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N>::numpy_sexpr()
+        : mem(utils::no_memory()), buffer(nullptr), _shape(), _strides()
+    {
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N>::numpy_sexpr(utils::shared_ref<raw_array<T>> const &mem,
+                                   T *buffer, array<long, N> const &shape,
+                                   array<long, N> const &strides)
+        : mem(mem), buffer(buffer), _shape(shape), _strides(strides)
+    {
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N>::numpy_sexpr(ndarray<T, N> const &arr)
+        : mem(arr.mem), buffer(arr.buffer), _shape(arr.shape())
+    {
+      _strides[N - 1] = 1;
+      for (size_t i = N - 1; i > 0; --i)
+        _strides[i - 1] = _strides[i] * _shape[i];
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator=(E const &expr)
+    {
+      static_assert(value >= utils::dim_of<E>::value, "dimensions match");
+      // the source may read the memory we are writing to, e.g.
+      // ``a[1:] = a[:-1]'', in which case it is evaluated first
+      using Source =
+          typename std::conditional<may_overlap_gexpr<E>::value,
+                                    ndarray<typename dtype_of<E>::type,
+                                            utils::dim_of<E>::value>,
+                                    E const &>::type;
+      Source source = expr;
+      return utils::broadcast_copy<numpy_sexpr &,
+                                   typename std::decay<Source>::type, value,
+                                   value - utils::dim_of<E>::value, false>(
+          *this, source);
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator=(numpy_sexpr const &expr)
+    {
+      return operator=<numpy_sexpr>(expr);
+    }
+
+    namespace details
+    {
+      template <class Op, class T, class V>
+      void strided_update(T *buffer, long const *shape, long const *strides,
+                          V const &value, utils::int_<1>)
+      {
+        for (long i = 0, n = shape[0], stride = strides[0]; i < n; ++i)
+          Op{}(buffer[i * stride], value);
+      }
+
+      template <class Op, class T, class V, size_t N>
+      void strided_update(T *buffer, long const *shape, long const *strides,
+                          V const &value, utils::int_<N>)
+      {
+        for (long i = 0, n = shape[0]; i < n; ++i)
+          strided_update<Op>(buffer + i * strides[0], shape + 1, strides + 1,
+                             value, utils::int_<N - 1>());
+      }
+    }
+
+    template <class T, size_t N>
+    template <class Op, class E>
+    typename std::enable_if<not is_dtype<E>::value, numpy_sexpr<T, N> &>::type
+    numpy_sexpr<T, N>::update_(E const &expr)
+    {
+      static_assert(value >= utils::dim_of<E>::value, "dimensions match");
+      using Source = typename std::conditional<
+          may_overlap_gexpr<E>::value,
+          ndarray<typename dtype_of<E>::type, utils::dim_of<E>::value>,
+          E const &>::type;
+      Source source = expr;
+      return utils::broadcast_update<Op, numpy_sexpr &,
+                                     typename std::decay<Source>::type, value,
+                                     value - utils::dim_of<E>::value, false>(
+          *this, source);
+    }
+
+    template <class T, size_t N>
+    template <class Op, class E>
+    typename std::enable_if<is_dtype<E>::value, numpy_sexpr<T, N> &>::type
+    numpy_sexpr<T, N>::update_(E const &expr)
+    {
+      details::strided_update<Op>(buffer, _shape.data(), _strides.data(),
+                                  expr, utils::int_<N>());
+      return *this;
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator+=(E const &expr)
+    {
+      return update_<pythonic::operator_::functor::iadd>(expr);
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator-=(E const &expr)
+    {
+      return update_<pythonic::operator_::functor::isub>(expr);
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator*=(E const &expr)
+    {
+      return update_<pythonic::operator_::functor::imul>(expr);
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator/=(E const &expr)
+    {
+      return update_<pythonic::operator_::functor::idiv>(expr);
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator&=(E const &expr)
+    {
+      return update_<pythonic::operator_::functor::iand>(expr);
+    }
+
+    template <class T, size_t N>
+    template <class E>
+    numpy_sexpr<T, N> &numpy_sexpr<T, N>::operator|=(E const &expr)
+    {
+      return update_<pythonic::operator_::functor::ior>(expr);
+    }
+
+    template <class T, size_t N>
+    typename numpy_sexpr<T, N>::const_iterator numpy_sexpr<T, N>::begin() const
+    {
+      return {*this, 0};
+    }
+
+    template <class T, size_t N>
+    typename numpy_sexpr<T, N>::const_iterator numpy_sexpr<T, N>::end() const
+    {
+      return {*this, _shape[0]};
+    }
+
+    template <class T, size_t N>
+    typename numpy_sexpr<T, N>::iterator numpy_sexpr<T, N>::begin()
+    {
+      return {*this, 0};
+    }
+
+    template <class T, size_t N>
+    typename numpy_sexpr<T, N>::iterator numpy_sexpr<T, N>::end()
+    {
+      return {*this, _shape[0]};
+    }
+
+    template <class T, size_t N>
+    auto numpy_sexpr<T, N>::fast(long i) const
+        -> decltype(numpy_sexpr_helper<T, N>::get(*this, i))
+    {
+      return numpy_sexpr_helper<T, N>::get(*this, i);
+    }
+
+    template <class T, size_t N>
+    auto numpy_sexpr<T, N>::fast(long i)
+        -> decltype(numpy_sexpr_helper<T, N>::get(*this, i))
+    {
+      return numpy_sexpr_helper<T, N>::get(*this, i);
+    }
+
+    template <class T, size_t N>
+    auto numpy_sexpr<T, N>::operator[](long i) const -> decltype(this->fast(i))
+    {
+      if (i < 0)
+        i += _shape[0];
+      return fast(i);
+    }
+
+    template <class T, size_t N>
+    auto numpy_sexpr<T, N>::operator[](long i) -> decltype(this->fast(i))
+    {
+      if (i < 0)
+        i += _shape[0];
+      return fast(i);
+    }
+
+    template <class T, size_t N>
+    auto numpy_sexpr<T, N>::operator()(long i) const -> decltype(this->fast(i))
+    {
+      return (*this)[i];
+    }
+
+    template <class T, size_t N>
+    auto numpy_sexpr<T, N>::operator()(long i) -> decltype(this->fast(i))
+    {
+      return (*this)[i];
+    }
+
+    template <class T, size_t N>
+    T const &numpy_sexpr<T, N>::
+    operator[](array<long, N> const &indices) const
+    {
+      T const *where = buffer;
+      for (size_t i = 0; i < N; ++i)
+        where += (indices[i] < 0 ? indices[i] + _shape[i] : indices[i]) *
+                 _strides[i];
+      return *where;
+    }
+
+    template <class T, size_t N>
+    T &numpy_sexpr<T, N>::operator[](array<long, N> const &indices)
+    {
+      T *where = buffer;
+      for (size_t i = 0; i < N; ++i)
+        where += (indices[i] < 0 ? indices[i] + _shape[i] : indices[i]) *
+                 _strides[i];
+      return *where;
+    }
+
+    template <class T, size_t N>
+    T const &numpy_sexpr<T, N>::fast(array<long, N> const &indices) const
+    {
+      T const *where = buffer;
+      for (size_t i = 0; i < N; ++i)
+        where += indices[i] * _strides[i];
+      return *where;
+    }
+
+    template <class T, size_t N>
+    T &numpy_sexpr<T, N>::fast(array<long, N> const &indices)
+    {
+      T *where = buffer;
+      for (size_t i = 0; i < N; ++i)
+        where += indices[i] * _strides[i];
+      return *where;
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N> numpy_sexpr<T, N>::operator[](slice const &s0) const
+    {
+      return _get(utils::int_<0>(), s0);
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N> numpy_sexpr<T, N>::
+    operator[](contiguous_slice const &s0) const
+    {
+      return _get(utils::int_<0>(), s0);
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N> numpy_sexpr<T, N>::operator()(slice const &s0) const
+    {
+      return _get(utils::int_<0>(), s0);
+    }
+
+    template <class T, size_t N>
+    numpy_sexpr<T, N> numpy_sexpr<T, N>::
+    operator()(contiguous_slice const &s0) const
+    {
+      return _get(utils::int_<0>(), s0);
+    }
+
+    template <class T, size_t N>
+    template <class S0, class S1, class... S>
+    auto numpy_sexpr<T, N>::operator()(S0 const &s0, S1 const &s1,
+                                       S const &... s) const
+        -> decltype(this->_get(
+            utils::int_<count_long<S0, S1, S...>::value == N>(), s0, s1,
+            s...))
+    {
+      return _get(utils::int_<count_long<S0, S1, S...>::value == N>(), s0, s1,
+                  s...);
+    }
+
+    template <class T, size_t N>
+    template <class... S>
+    T &numpy_sexpr<T, N>::_get(utils::int_<1>, S const &... s) const
+    {
+      return const_cast<T &>((*this)[array<long, N>{{s...}}]);
+    }
+
+    template <class T, size_t N>
+    template <class... S>
+    numpy_sexpr<T, N - count_long<S...>::value>
+    numpy_sexpr<T, N>::_get(utils::int_<0>, S const &... s) const
+    {
+      numpy_sexpr<T, N - count_long<S...>::value> res;
+      res.mem = mem;
+      res.buffer = buffer;
+      _apply(res, 0, 0, s...);
+      return res;
+    }
+
+    template <class T, size_t N>
+    template <class R>
+    void numpy_sexpr<T, N>::_apply(R &res, size_t in, size_t out) const
+    {
+      // dimensions without index are kept as is
+      for (; in < N; ++in, ++out) {
+        res._shape[out] = _shape[in];
+        res._strides[out] = _strides[in];
+      }
+    }
+
+    template <class T, size_t N>
+    template <class R, class... S>
+    void numpy_sexpr<T, N>::_apply(R &res, size_t in, size_t out, long i,
+                                   S const &... s) const
+    {
+      res.buffer += (i < 0 ? i + _shape[in] : i) * _strides[in];
+      _apply(res, in + 1, out, s...);
+    }
+
+    template <class T, size_t N>
+    template <class R, class S0, class... S>
+    void numpy_sexpr<T, N>::_apply(R &res, size_t in, size_t out,
+                                   S0 const &s0, S const &... s) const
+    {
+      auto ns = s0.normalize(_shape[in]);
+      res.buffer += ns.lower * _strides[in];
+      res._shape[out] = ns.size();
+      res._strides[out] = ns.step * _strides[in];
+      _apply(res, in + 1, out + 1, s...);
+    }
+
+    template <class T, size_t N>
+    long numpy_sexpr<T, N>::size() const
+    {
+      return _shape[0];
+    }
+
+    template <class T, size_t N>
+    long numpy_sexpr<T, N>::flat_size() const
+    {
+      return std::accumulate(_shape.begin(), _shape.end(), 1L,
+                             std::multiplies<long>());
+    }
+
+    template <class T, size_t N>
+    array<long, N> const &numpy_sexpr<T, N>::shape() const
+    {
+      return _shape;
+    }
+
+    template <class T, size_t N>
+    intptr_t numpy_sexpr<T, N>::id() const
+    {
+      return reinterpret_cast<intptr_t>(&(*mem));
+    }
+
+    template <class T, size_t N>
+    ndarray<T, N> numpy_sexpr<T, N>::copy() const
+    {
+      return {*this};
+    }
+
+    template <class T, size_t N>
+    typename numpy_sexpr_helper<T, N>::type
+    numpy_sexpr_helper<T, N>::get(numpy_sexpr<T, N> const &e, long i)
+    {
+      type res;
+      res.mem = e.mem;
+      res.buffer = e.buffer + i * e._strides[0];
+      std::copy(e._shape.begin() + 1, e._shape.end(), res._shape.begin());
+      std::copy(e._strides.begin() + 1, e._strides.end(),
+                res._strides.begin());
+      return res;
+    }
+
+    template <class T>
+    T const &numpy_sexpr_helper<T, 1>::get(numpy_sexpr<T, 1> const &e, long i)
+    {
+      return e.buffer[i * e._strides[0]];
+    }
+
+    template <class T>
+    T &numpy_sexpr_helper<T, 1>::get(numpy_sexpr<T, 1> &e, long i)
+    {
+      return e.buffer[i * e._strides[0]];
+    }
+  }
+}
+
+#endif
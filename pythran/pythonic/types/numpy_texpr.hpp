@@ -138,6 +138,22 @@ namespace pythonic
       return arg[array<long, 2>{{indices[1], indices[0]}}];
     }
 
+    template <class E>
+    auto numpy_texpr_2<E>::fast(
+        array<long, numpy_texpr_2<E>::value> const &indices)
+        -> decltype(arg.fast(array<long, 2>{{indices[1], indices[0]}}))
+    {
+      return arg.fast(array<long, 2>{{indices[1], indices[0]}});
+    }
+
+    template <class E>
+    auto numpy_texpr_2<E>::fast(
+        array<long, numpy_texpr_2<E>::value> const &indices) const
+        -> decltype(arg.fast(array<long, 2>{{indices[1], indices[0]}}))
+    {
+      return arg.fast(array<long, 2>{{indices[1], indices[0]}});
+    }
+
     template <class E>
     auto numpy_texpr_2<E>::operator()(contiguous_slice const &s0) const
         -> decltype(this->arg(contiguous_slice(pythonic::__builtin__::None,
@@ -2,6 +2,7 @@
 #define PYTHONIC_TYPES_RAW_ARRAY_HPP
 
 #include "pythonic/include/types/raw_array.hpp"
+#include "pythonic/utils/allocate.hpp"
 
 namespace pythonic
 {
@@ -14,33 +15,38 @@ namespace pythonic
      */
     template <class T>
     raw_array<T>::raw_array()
-        : data(nullptr)
+        : data(nullptr), nbytes(0)
     {
     }
 
     template <class T>
     raw_array<T>::raw_array(size_t n)
-        : data((T *)malloc(sizeof(T) * n))
+        : data(utils::allocate<T>(n)), nbytes(sizeof(T) * n)
     {
     }
 
     template <class T>
     raw_array<T>::raw_array(T *d)
-        : data(d)
+        : data(d), nbytes(0)
     {
     }
 
     template <class T>
     raw_array<T>::raw_array(raw_array<T> &&d)
-        : data(d.data)
+        : data(d.data), nbytes(d.nbytes)
     {
       d.data = nullptr;
+      d.nbytes = 0;
     }
 
     template <class T>
     raw_array<T>::~raw_array()
     {
-      if (data)
+      // the byte count is used rather than an element count because raw_array
+      // are sometimes reinterpreted, see getattr<attr::REAL>
+      if (nbytes)
+        utils::deallocate((char *)data, nbytes);
+      else if (data)
         free(data);
     }
   }
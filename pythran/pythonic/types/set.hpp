@@ -7,13 +7,13 @@
 #include "pythonic/types/empty_iterator.hpp"
 #include "pythonic/types/list.hpp"
 
+#include "pythonic/utils/flat_hash_table.hpp"
 #include "pythonic/utils/iterator.hpp"
 #include "pythonic/utils/reserve.hpp"
 #include "pythonic/utils/shared_ref.hpp"
 
 #include "pythonic/__builtin__/in.hpp"
 
-#include <set>
 #include <memory>
 #include <utility>
 #include <limits>
@@ -26,6 +26,47 @@ namespace pythonic
   namespace types
   {
 
+    namespace details
+    {
+      template <class V>
+      bool in_all(V const &)
+      {
+        return true;
+      }
+
+      template <class V, class U, class... Types>
+      bool in_all(V const &value, U const &other, Types const &... others)
+      {
+        return in(other, value) and in_all(value, others...);
+      }
+
+      template <class S>
+      void insert_all(S &)
+      {
+      }
+
+      template <class S, class U, class... Types>
+      void insert_all(S &s, U const &other, Types const &... others)
+      {
+        for (auto const &elem : other)
+          s.add(elem);
+        insert_all(s, others...);
+      }
+
+      template <class S>
+      void discard_all(S &)
+      {
+      }
+
+      template <class S, class U, class... Types>
+      void discard_all(S &s, U const &other, Types const &... others)
+      {
+        for (auto const &elem : other)
+          s.discard(elem);
+        discard_all(s, others...);
+      }
+    }
+
     /// set implementation
     // constructors
     template <class T>
@@ -65,8 +106,7 @@ namespace pythonic
     set<T>::set(set<F> const &other)
         : data()
     {
-      std::copy(other.begin(), other.end(),
-                std::inserter(*data, data->begin()));
+      data->insert(other.begin(), other.end());
     }
 
     // iterators
@@ -94,30 +134,6 @@ namespace pythonic
       return data->end();
     }
 
-    template <class T>
-    typename set<T>::reverse_iterator set<T>::rbegin()
-    {
-      return data->rbegin();
-    }
-
-    template <class T>
-    typename set<T>::const_reverse_iterator set<T>::rbegin() const
-    {
-      return data->rbegin();
-    }
-
-    template <class T>
-    typename set<T>::reverse_iterator set<T>::rend()
-    {
-      return data->rend();
-    }
-
-    template <class T>
-    typename set<T>::const_reverse_iterator set<T>::rend() const
-    {
-      return data->rend();
-    }
-
     // modifiers
     template <class T>
     T set<T>::pop()
@@ -185,7 +201,10 @@ namespace pythonic
     template <class T>
     set<T> set<T>::copy() const
     {
-      return set<T>(begin(), end());
+      set<T> res = empty_set();
+      // copying the container reuses the hash of the elements
+      *res.data = *data;
+      return res;
     }
 
     template <class T>
@@ -193,10 +212,9 @@ namespace pythonic
     bool set<T>::isdisjoint(U const &other) const
     {
       // Return true if the this has no elements in common with other.
-      for (iterator it = begin(); it != end(); ++it) {
-        if (in(other, *it))
+      for (auto const &elem : *data)
+        if (in(other, elem))
           return false;
-      }
       return true;
     }
 
@@ -205,10 +223,9 @@ namespace pythonic
     bool set<T>::issubset(U const &other) const
     {
       // Test whether every element in the set is in other.
-      for (iterator it = begin(); it != end(); ++it) {
-        if (not in(other, *it))
+      for (auto const &elem : *data)
+        if (not in(other, elem))
           return false;
-      }
       return true;
     }
 
@@ -223,7 +240,7 @@ namespace pythonic
     template <class T>
     set<T> set<T>::union_() const
     {
-      return set<T>(begin(), end());
+      return copy();
     }
 
     template <class T>
@@ -241,14 +258,15 @@ namespace pythonic
     template <typename... Types>
     none_type set<T>::update(Types &&... others)
     {
-      *this = union_(std::forward<Types>(others)...);
+      // in place, so that every reference to this set sees the update
+      details::insert_all(*this, others...);
       return {};
     }
 
     template <class T>
     set<T> set<T>::intersection() const
     {
-      return set<T>(begin(), end());
+      return copy();
     }
 
     template <class T>
@@ -259,11 +277,12 @@ namespace pythonic
       // Return a new set with elements common to the set and all others.
       typename __combined<set<T>, U, Types...>::type tmp =
           intersection(others...);
-      for (auto it = tmp.begin(); it != tmp.end(); ++it) {
-        if (not in(other, *it))
-          tmp.discard(
-              *it); // faster than remove() but not direct interaction with data
-      }
+      // erasing does not invalidate iterators of the hash set
+      for (auto it = tmp.data->begin(); it != tmp.data->end();)
+        if (in(other, *it))
+          ++it;
+        else
+          it = tmp.data->erase(it);
       return tmp;
     }
 
@@ -271,13 +290,17 @@ namespace pythonic
     template <typename... Types>
     void set<T>::intersection_update(Types const &... others)
     {
-      *this = intersection(others...);
+      for (auto it = data->begin(); it != data->end();)
+        if (details::in_all(*it, others...))
+          ++it;
+        else
+          it = data->erase(it);
     }
 
     template <class T>
     set<T> set<T>::difference() const
     {
-      return set<T>(begin(), end());
+      return copy();
     }
 
     template <class T>
@@ -286,17 +309,7 @@ namespace pythonic
     {
       // Return a new set with elements in the set that are not in the others.
       set<T> tmp = difference(others...);
-      /*
-                   for(iterator it=tmp.begin(); it!=tmp.end();++it){
-                   if(other.get_data().find(*it)!=other.end())
-                   tmp.discard(*it);
-                   }
-                   */ // This algo will do several times the same find(), because
-         // std::set::erase() calls find. Lame!
-      for (typename U::const_iterator it = other.begin(); it != other.end();
-           ++it) {
-        tmp.discard(*it);
-      }
+      details::discard_all(tmp, other);
       return tmp;
     }
 
@@ -311,7 +324,7 @@ namespace pythonic
     template <typename... Types>
     void set<T>::difference_update(Types const &... others)
     {
-      *this = difference(others...);
+      details::discard_all(*this, others...);
     }
 
     template <class T>
@@ -320,11 +333,12 @@ namespace pythonic
     set<T>::symmetric_difference(set<U> const &other) const
     {
       // Return a new set with elements in either the set or other but not both.
-      // return ((*this-other) | (other-*this));
-
-      // We must use fcts and not operators because fcts have to handle any
-      // iterable objects and operators only sets (cf python ref)
-      return (this->difference(other)).union_(other.difference(*this));
+      set<typename __combined<T, U>::type> tmp(begin(), end());
+      // elements of a set are unique, so each of them is toggled once
+      for (auto const &elem : other)
+        if (not tmp.data->erase(elem))
+          tmp.add(elem);
+      return tmp;
     }
 
     template <class T>
@@ -334,17 +348,18 @@ namespace pythonic
     {
       // Return a new set with elements in either the set or other but not both.
       set<typename U::iterator::value_type> tmp(other.begin(), other.end());
-
-      // We must use fcts and not operators because fcts have to handle any
-      // iterable objects and operators only sets (cf python ref)
-      return (this->difference(other)).union_(tmp.difference(*this));
+      return symmetric_difference(tmp);
     }
 
     template <class T>
     template <typename U>
     void set<T>::symmetric_difference_update(U const &other)
     {
-      *this = symmetric_difference(other);
+      // duplicates are removed first, so that each element is toggled once
+      set<typename U::iterator::value_type> tmp(other.begin(), other.end());
+      for (auto const &elem : tmp)
+        if (not data->erase(elem))
+          add(elem);
     }
 
     // Operators
@@ -352,7 +367,7 @@ namespace pythonic
     template <class U>
     bool set<T>::operator==(set<U> const &other) const
     {
-      return *data == *other.data;
+      return size() == other.size() and issubset(other);
     }
 
     template <class T>
@@ -407,6 +422,9 @@ namespace pythonic
     set<typename __combined<U, T>::type> set<T>::
     operator&(set<U> const &other) const
     {
+      // look the elements of the smallest set up in the largest one
+      if (other.size() < size())
+        return other.intersection(*this);
       return intersection(other);
     }
 
@@ -11,8 +11,10 @@
 #include "pythonic/utils/functor.hpp"
 #include "pythonic/utils/int_.hpp"
 
+#include <algorithm>
 #include <boost/format.hpp>
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <cstring>
 #include <sstream>
@@ -99,6 +101,9 @@ namespace pythonic
                               typename S::normalized_type const &s)
         : data(other.data), slicing(s)
     {
+      // the slice is relative to the view, make it relative to the buffer
+      slicing.lower += other.offset;
+      slicing.upper += other.offset;
     }
 
     // const getter
@@ -139,17 +144,33 @@ namespace pythonic
 
     // accessor
     template <class S>
-    char const &sliced_str<S>::operator[](long i) const
+    char const &sliced_str<S>::fast(long i) const
     {
       return (*data)[slicing.get(i)];
     }
 
     template <class S>
-    char &sliced_str<S>::operator[](long i)
+    char &sliced_str<S>::fast(long i)
     {
       return (*data)[slicing.get(i)];
     }
 
+    template <class S>
+    char const &sliced_str<S>::operator[](long i) const
+    {
+      if (i < 0)
+        i += size();
+      return fast(i);
+    }
+
+    template <class S>
+    char &sliced_str<S>::operator[](long i)
+    {
+      if (i < 0)
+        i += size();
+      return fast(i);
+    }
+
     template <class S>
     sliced_str<slice> sliced_str<S>::operator[](slice const &s) const
     {
@@ -174,7 +195,7 @@ namespace pythonic
     sliced_str<S>::operator long() const
     {
       long out;
-      std::istringstream iss(str(*this).get_data());
+      std::istringstream iss(str(*this).c_str());
       iss >> out;
       return out;
     }
@@ -203,15 +224,17 @@ namespace pythonic
     template <class S>
     str sliced_str<S>::operator+(sliced_str<S> const &s)
     {
-      str out(*data);
-      std::copy(s.begin(), s.end(), std::copy(begin(), end(), out.begin()));
-      return out;
+      std::string out(begin(), end());
+      out.append(s.begin(), s.end());
+      return {std::move(out)};
     }
 
     template <class S>
     size_t sliced_str<S>::find(str const &s, size_t pos) const
     {
-      return str(*this).find(s); // quite inefficient
+      // contiguous slices convert to a view, and are searched in place
+      long res = str(*this).find(s, pos);
+      return res < 0 ? std::string::npos : res;
     }
 
     template <class S>
@@ -227,59 +250,77 @@ namespace pythonic
     {
       if (slicing.step == 1) {
         data->erase(slicing.lower, slicing.upper);
-        data->insert(slicing.lower, s.get_data());
+        data->insert(slicing.lower, s.chars(), s.size());
       } else
         assert("not implemented yet");
       return *this;
     }
 
     /// str implementation
-    str::str() : data()
+    str::str() : data(), offset(0), length(0)
     {
     }
 
-    str::str(std::string const &s) : data(s)
+    str::str(std::string const &s) : data(s), offset(0), length(s.size())
     {
     }
 
-    str::str(std::string &&s) : data(std::move(s))
+    str::str(std::string &&s)
+        : data(std::move(s)), offset(0), length(data->size())
     {
     }
 
-    str::str(const char *s) : data(s)
+    str::str(const char *s) : data(s), offset(0), length(data->size())
     {
     }
 
-    str::str(const char *s, size_t n) : data(s, n)
+    str::str(const char *s, size_t n) : data(s, n), offset(0), length(n)
     {
     }
 
-    str::str(char c) : data(1, c)
+    str::str(char c) : data(1, c), offset(0), length(1)
     {
     }
 
     template <class S>
     str::str(sliced_str<S> const &other)
-        : data(other.begin(), other.end())
+        : data(other.data), offset(other.slicing.lower), length(other.size())
     {
+      // only contiguous slices can share their buffer
+      if (other.slicing.step != 1)
+        *this = str(other.begin(), other.end());
     }
 
     template <class T>
     str::str(T const &begin, T const &end)
-        : data(begin, end)
+        : data(begin, end), offset(0), length(data->size())
+    {
+    }
+
+    str::str(utils::shared_ref<container_type> const &data, size_t offset,
+             size_t length)
+        : data(data), offset(offset), length(length)
+    {
+    }
+
+    void str::own()
     {
+      if (offset != 0 or length != data->size() or not data.unique()) {
+        data = utils::shared_ref<container_type>(chars(), length);
+        offset = 0;
+      }
     }
 
     str::operator char() const
     {
       assert(size() == 1);
-      return (*data)[0];
+      return chars()[0];
     }
 
     str::operator long int() const
     { // Allows implicit conversion without loosing bool conversion
       char *endptr;
-      auto dat = data->data();
+      auto dat = c_str();
       long res = strtol(dat, &endptr, 10);
       if (endptr == dat) {
         std::ostringstream err;
@@ -292,10 +333,10 @@ namespace pythonic
     str::operator pythran_long_t() const
     {
 #ifdef USE_GMP
-      return pythran_long_t(*data);
+      return pythran_long_t(c_str());
 #else
       char *endptr;
-      auto dat = data->data();
+      auto dat = c_str();
       pythran_long_t res = strtoll(dat, &endptr, 10);
       if (endptr == dat) {
         std::ostringstream err;
@@ -309,7 +350,7 @@ namespace pythonic
     str::operator double() const
     {
       char *endptr;
-      auto dat = data->data();
+      auto dat = c_str();
       double res = strtod(dat, &endptr);
       if (endptr == dat) {
         std::ostringstream err;
@@ -322,84 +363,80 @@ namespace pythonic
     template <class S>
     str &str::operator=(sliced_str<S> const &other)
     {
-      if (other.get_data() == *data) {
-        auto it = std::copy(other.begin(), other.end(), begin());
-        resize(it - this->begin());
-      } else
-        *this = other.get_data();
-      return *this;
+      return *this = str(other);
     }
 
     str &str::operator+=(str const &s)
     {
-      *data += *s.data;
+      own();
+      data->append(s.chars(), s.size());
+      length = data->size();
       return *this;
     }
 
-    str::container_type const &str::get_data() const
-    {
-      return *data;
-    }
-
     long str::size() const
     {
-      return data->size();
+      return length;
     }
 
-    auto str::begin() const -> decltype(data->begin())
+    char const *str::chars() const
     {
-      return data->begin();
+      return data->data() + offset;
     }
 
-    auto str::begin() -> decltype(data->begin())
+    auto str::begin() const -> const_iterator
     {
-      return data->begin();
+      return chars();
     }
 
-    auto str::rbegin() const -> decltype(data->rbegin())
+    auto str::rbegin() const -> const_reverse_iterator
     {
-      return data->rbegin();
+      return const_reverse_iterator(end());
     }
 
-    auto str::rbegin() -> decltype(data->rbegin())
+    auto str::end() const -> const_iterator
     {
-      return data->rbegin();
+      return chars() + length;
     }
 
-    auto str::end() const -> decltype(data->end())
+    auto str::rend() const -> const_reverse_iterator
     {
-      return data->end();
+      return const_reverse_iterator(begin());
     }
 
-    auto str::end() -> decltype(data->end())
+    char const *str::c_str() const
     {
-      return data->end();
-    }
-
-    auto str::rend() const -> decltype(data->rend())
-    {
-      return data->rend();
-    }
-
-    auto str::rend() -> decltype(data->rend())
-    {
-      return data->rend();
-    }
-
-    auto str::c_str() const -> decltype(data->c_str())
-    {
-      return data->c_str();
+      if (offset + length != data->size()) {
+        data = utils::shared_ref<container_type>(chars(), length);
+        offset = 0;
+      }
+      return data->c_str() + offset;
     }
 
-    auto str::resize(long n) -> decltype(data->resize(n))
+    void str::resize(long n)
     {
-      return data->resize(n);
+      own();
+      data->resize(n);
+      length = n;
     }
 
     long str::find(str const &s, size_t pos) const
     {
-      const char *res = strstr(c_str() + pos, s.c_str());
-      return res ? res - c_str() : -1;
+      size_t n = s.size();
+      if (pos > length or n > length - pos)
+        return -1;
+      if (n == 0)
+        return pos;
+      // memchr scans for the first needle character several bytes at a time,
+      // only its matches are compared further
+      char const *first = chars();
+      char const *needle = s.chars();
+      char const *last = first + length - n + 1;
+      for (char const *iter = first + pos;
+           (iter = (char const *)memchr(iter, *needle, last - iter)); ++iter)
+        if (memcmp(iter + 1, needle + 1, n - 1) == 0)
+          return iter - first;
+      return -1;
     }
 
     bool str::contains(str const &v) const
@@ -409,86 +446,120 @@ namespace pythonic
 
     long str::find_first_of(str const &s, size_t pos) const
     {
-      return data->find_first_of(*s.data, pos);
+      if (pos >= length)
+        return -1;
+      char const *first = chars();
+      char const *res = s.size() == 1
+                            ? (char const *)memchr(first + pos, *s.chars(),
+                                                   length - pos)
+                            : std::find_first_of(first + pos, end(), s.begin(),
+                                                 s.end());
+      return (res == nullptr or res == end()) ? -1 : res - first;
     }
 
     long str::find_first_of(const char *s, size_t pos) const
     {
-      return data->find_first_of(s, pos);
+      if (pos >= length)
+        return -1;
+      char const *res =
+          std::find_first_of(begin() + pos, end(), s, s + strlen(s));
+      return res == end() ? -1 : res - begin();
     }
 
     long str::find_first_not_of(str const &s, size_t pos) const
     {
-      return data->find_first_not_of(*s.data, pos);
+      for (; pos < length; ++pos)
+        if (not memchr(s.chars(), chars()[pos], s.size()))
+          return pos;
+      return -1;
     }
 
     long str::find_last_not_of(str const &s, size_t pos) const
     {
-      return data->find_last_not_of(*s.data, pos);
+      if (length == 0)
+        return -1;
+      for (pos = std::min(pos, length - 1) + 1; pos-- > 0;)
+        if (not memchr(s.chars(), chars()[pos], s.size()))
+          return pos;
+      return -1;
     }
 
     str str::substr(size_t pos, size_t len) const
     {
-      return data->substr(pos, len);
+      if (pos > length)
+        throw std::out_of_range("str::substr");
+      return {data, offset + pos, std::min(len, length - pos)};
     }
 
     bool str::empty() const
     {
-      return data->empty();
+      return length == 0;
     }
 
     int str::compare(size_t pos, size_t len, str const &str) const
     {
-      return data->compare(pos, len, *str.data);
+      if (pos > length)
+        throw std::out_of_range("str::compare");
+      len = std::min(len, length - pos);
+      size_t other_len = str.length;
+      int res = memcmp(chars() + pos, str.chars(), std::min(len, other_len));
+      if (res)
+        return res;
+      return len < other_len ? -1 : len > other_len;
     }
 
     void str::reserve(size_t n)
     {
+      own();
       data->reserve(n);
     }
 
     str &str::replace(size_t pos, size_t len, str const &str)
     {
-      data->replace(pos, len, *str.data);
+      own();
+      data->replace(pos, len, str.chars(), str.size());
+      length = data->size();
       return *this;
     }
 
     template <class S>
     str &str::operator+=(sliced_str<S> const &other)
     {
-      resize(size() + other.get_data().size());
-      std::copy(other.begin(), other.end(), begin());
+      own();
+      data->append(other.begin(), other.end());
+      length = data->size();
       return *this;
     }
 
     bool str::operator==(str const &other) const
     {
-      return *data == *other.data;
+      return length == other.length and
+             memcmp(chars(), other.chars(), length) == 0;
     }
 
     bool str::operator!=(str const &other) const
     {
-      return *data != *other.data;
+      return not(*this == other);
     }
 
     bool str::operator<=(str const &other) const
     {
-      return *data <= *other.data;
+      return compare(0, npos, other) <= 0;
     }
 
     bool str::operator<(str const &other) const
     {
-      return *data < *other.data;
+      return compare(0, npos, other) < 0;
     }
 
     bool str::operator>=(str const &other) const
     {
-      return *data >= *other.data;
+      return compare(0, npos, other) >= 0;
     }
 
     bool str::operator>(str const &other) const
     {
-      return *data > *other.data;
+      return compare(0, npos, other) > 0;
     }
 
     template <class S>
@@ -496,9 +567,8 @@ namespace pythonic
     {
       if (size() != other.size())
         return false;
-      for (long i = other.get_slice().lower, j = 0L; j < size();
-           i = i + other.get_slice().step, j++)
-        if (other.get_data()[i] != (*this)[j])
+      for (long i = 0; i < size(); ++i)
+        if (other.fast(i) != fast(i))
           return false;
       return true;
     }
@@ -514,18 +584,16 @@ namespace pythonic
       return operator[](s);
     }
 
-    char str::operator[](long i) const
+    char str::fast(long i) const
     {
-      if (i < 0)
-        i += size();
-      return (*data)[i];
+      return chars()[i];
     }
 
-    char &str::operator[](long i)
+    char str::operator[](long i) const
     {
       if (i < 0)
         i += size();
-      return (*data)[i];
+      return fast(i);
     }
 
     sliced_str<slice> str::operator[](slice const &s) const
@@ -544,29 +612,24 @@ namespace pythonic
     {
       return (*this)[m.get_si()];
     }
-
-    char &str::operator[](pythran_long_t const &m)
-    {
-      return (*this)[m.get_si()];
-    }
 #endif
 
     str::operator bool() const
     {
-      return not data->empty();
+      return length != 0;
     }
 
     template <class A>
     str str::operator%(A const &a) const
     {
-      const boost::format fmter(*data);
+      const boost::format fmter(std::string(chars(), length));
       return (boost::format(fmter) % a).str();
     }
 
     template <class... A>
     types::str str::operator%(std::tuple<A...> const &a) const
     {
-      boost::format fmter(*data);
+      boost::format fmter(std::string(chars(), length));
       fmt(fmter, a, utils::int_<sizeof...(A)>());
       return fmter.str();
     }
@@ -574,7 +637,7 @@ namespace pythonic
     template <size_t N, class T>
     str str::operator%(types::array<T, N> const &a) const
     {
-      boost::format fmter(*data);
+      boost::format fmter(std::string(chars(), length));
       fmt(fmter, a, utils::int_<N>());
       return fmter.str();
     }
@@ -606,7 +669,11 @@ namespace pythonic
 
     str operator+(str const &self, str const &other)
     {
-      return str(self.get_data() + other.get_data());
+      std::string s;
+      s.reserve(self.size() + other.size());
+      s.append(self.chars(), self.size());
+      s.append(other.chars(), other.size());
+      return {std::move(s)};
     }
 
     template <size_t N>
@@ -614,7 +681,7 @@ namespace pythonic
     {
       std::string s;
       s.reserve(self.size() + N);
-      s += self.get_data();
+      s.append(self.chars(), self.size());
       s += other;
       return {std::move(s)};
     }
@@ -625,7 +692,7 @@ namespace pythonic
       std::string s;
       s.reserve(other.size() + N);
       s += self;
-      s += other.get_data();
+      s.append(other.chars(), other.size());
       return {std::move(s)};
     }
 
@@ -651,7 +718,7 @@ namespace pythonic
 
     std::ostream &operator<<(std::ostream &os, str const &s)
     {
-      return os << s.c_str();
+      return os.write(s.chars(), s.size());
     }
 
     size_t hash_value(str const &x)
@@ -676,12 +743,11 @@ pythonic::types::str operator*(pythonic::types::str const &s, long n)
 {
   if (n <= 0)
     return pythonic::types::str();
-  pythonic::types::str other;
-  other.resize(s.size() * n);
-  auto where = other.begin();
-  for (long i = 0; i < n; i++, where += s.size())
-    std::copy(s.begin(), s.end(), where);
-  return other;
+  std::string other;
+  other.reserve(s.size() * n);
+  for (long i = 0; i < n; i++)
+    other.append(s.chars(), s.size());
+  return {std::move(other)};
 }
 
 pythonic::types::str operator*(long t, pythonic::types::str const &s)
@@ -695,7 +761,20 @@ namespace std
   size_t hash<pythonic::types::str>::
   operator()(const pythonic::types::str &x) const
   {
-    return hash<std::string>()(x.get_data());
+    // the bytes of the view are hashed in place, eight at a time
+    char const *iter = x.chars();
+    size_t n = x.size();
+    uint64_t h = 0xcbf29ce484222325ULL ^ n;
+    for (; n >= 8; iter += 8, n -= 8) {
+      uint64_t word;
+      std::memcpy(&word, iter, 8);
+      word *= 0xbf58476d1ce4e5b9ULL;
+      h = (h ^ (word ^ (word >> 31))) * 0x94d049bb133111ebULL;
+    }
+    uint64_t word = 0;
+    std::memcpy(&word, iter, n);
+    h = (h ^ word) * 0xbf58476d1ce4e5b9ULL;
+    return h ^ (h >> 31);
   }
 
   template <size_t I>
@@ -708,7 +787,7 @@ namespace std
 
 #if PY_MAJOR_VERSION >= 3
 #define PyString_FromStringAndSize PyUnicode_FromStringAndSize
-#define PyString_Check PyUnicode_IS_ASCII
+#define PyString_Check(obj) (PyUnicode_Check(obj) && PyUnicode_IS_ASCII(obj))
 #define PyString_AS_STRING (char *) _PyUnicode_COMPACT_DATA
 #define PyString_GET_SIZE PyUnicode_GET_SIZE
 #endif
@@ -718,7 +797,7 @@ namespace pythonic
 
   PyObject *to_python<types::str>::convert(types::str const &v)
   {
-    return PyString_FromStringAndSize(v.c_str(), v.size());
+    return PyString_FromStringAndSize(v.chars(), v.size());
   }
 
   template <class S>
@@ -0,0 +1,172 @@
+#ifndef PYTHONIC_UTILS_ALLOCATE_HPP
+#define PYTHONIC_UTILS_ALLOCATE_HPP
+
+#include "pythonic/include/utils/allocate.hpp"
+
+#include <cstdint>
+#ifdef PYTHRAN_ALLOCATOR_STATS
+#include <cstdio>
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      /* aligned allocation compatible with ``free'' */
+      void *aligned_malloc(size_t bytes)
+      {
+#ifdef PYTHRAN_ALLOCATOR_STATS
+        ++get_allocator_stats().allocations;
+#endif
+#if PYTHRAN_ALLOCATOR == PYTHRAN_MALLOC_ALLOCATOR || defined(_WIN32)
+        // _aligned_malloc requires _aligned_free, which numpy does not call
+        return malloc(bytes);
+#else
+        void *ptr;
+        if (posix_memalign(&ptr, PYTHRAN_ALLOCATOR_ALIGNMENT,
+                           bytes ? bytes : 1))
+          return nullptr;
+        return ptr;
+#endif
+      }
+
+#if PYTHRAN_ALLOCATOR == PYTHRAN_POOLED_ALLOCATOR
+      /* Per-thread cache of free blocks, sorted by power-of-two size
+       * classes.
+       *
+       * Blocks are regular ``aligned_malloc'' blocks, so a block allocated
+       * by one thread may be released by another thread, or by numpy.
+       */
+      class memory_pool
+      {
+        static const size_t min_class = 6; // 64 bytes
+        static const size_t nb_classes = 8 * sizeof(size_t);
+
+        void *blocks[nb_classes][PYTHRAN_POOL_DEPTH];
+        size_t depth[nb_classes];
+
+      public:
+        enum state { unborn, alive, dead };
+
+        /* Trivially destructible, hence still readable once the pool is
+         * destroyed, e.g. when static or thread_local ndarrays are released
+         * after it.
+         */
+        static state &get_state()
+        {
+          static thread_local state current = unborn;
+          return current;
+        }
+
+        memory_pool() : depth()
+        {
+          get_state() = alive;
+        }
+
+        ~memory_pool()
+        {
+          for (size_t c = 0; c < nb_classes; ++c)
+            for (size_t i = 0; i < depth[c]; ++i)
+              free(blocks[c][i]);
+          get_state() = dead;
+        }
+
+        static size_t size_class(size_t bytes)
+        {
+          size_t c = min_class;
+          while ((size_t(1) << c) < bytes)
+            ++c;
+          return c;
+        }
+
+        void *get(size_t bytes)
+        {
+          if (bytes > PYTHRAN_POOL_MAX_SIZE)
+            return aligned_malloc(bytes);
+          size_t c = size_class(bytes);
+          if (depth[c]) {
+#ifdef PYTHRAN_ALLOCATOR_STATS
+            ++get_allocator_stats().pool_hits;
+#endif
+            return blocks[c][--depth[c]];
+          }
+          return aligned_malloc(size_t(1) << c);
+        }
+
+        void release(void *ptr, size_t bytes)
+        {
+          if (bytes <= PYTHRAN_POOL_MAX_SIZE) {
+            size_t c = size_class(bytes);
+            if (depth[c] < PYTHRAN_POOL_DEPTH) {
+              blocks[c][depth[c]++] = ptr;
+              return;
+            }
+          }
+          free(ptr);
+        }
+      };
+
+      /* the pool of the current thread, or nullptr once it is destroyed:
+       * blocks are then allocated and freed directly
+       */
+      memory_pool *get_memory_pool()
+      {
+        if (memory_pool::get_state() == memory_pool::dead)
+          return nullptr;
+        static thread_local memory_pool pool;
+        return &pool;
+      }
+#endif
+    }
+
+    template <class T>
+    T *allocate(size_t n)
+    {
+#ifdef PYTHRAN_ALLOCATOR_STATS
+      ++get_allocator_stats().requests;
+#endif
+#if PYTHRAN_ALLOCATOR == PYTHRAN_POOLED_ALLOCATOR
+      if (details::memory_pool *pool = details::get_memory_pool())
+        return (T *)pool->get(sizeof(T) * n);
+#endif
+      return (T *)details::aligned_malloc(sizeof(T) * n);
+    }
+
+    template <class T>
+    void deallocate(T *ptr, size_t n)
+    {
+#if PYTHRAN_ALLOCATOR == PYTHRAN_POOLED_ALLOCATOR
+      if (details::memory_pool *pool = details::get_memory_pool())
+        return pool->release(ptr, sizeof(T) * n);
+#endif
+      free(ptr);
+    }
+
+    bool is_aligned(void const *ptr, size_t alignment)
+    {
+      return (reinterpret_cast<std::uintptr_t>(ptr) % alignment) == 0;
+    }
+
+#ifdef PYTHRAN_ALLOCATOR_STATS
+    allocator_stats::~allocator_stats()
+    {
+      fprintf(stderr, "pythran allocator: %zu requests, %zu allocations, "
+                      "%zu pool hits\n",
+              requests, allocations, pool_hits);
+    }
+
+    allocator_stats &get_allocator_stats()
+    {
+      // not thread-safe, statistics are only meant for sequential benchmarks
+      static allocator_stats stats = {0, 0, 0};
+      return stats;
+    }
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef PYTHONIC_UTILS_BLOCKED_GEMM_HPP
+#define PYTHONIC_UTILS_BLOCKED_GEMM_HPP
+
+#include "pythonic/include/utils/blocked_gemm.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      template <class T, bool Simd>
+      void gemm_kernel<T, Simd>::apply(long kc, T const *a, T const *b, T *c,
+                                 long c_stride, long m, long n,
+                                 bool accumulate)
+      {
+        T acc[mr][nr] = {};
+        for (long p = 0; p < kc; ++p, a += mr, b += nr)
+          for (long i = 0; i < mr; ++i)
+            for (long j = 0; j < nr; ++j)
+              acc[i][j] += a[i] * b[j];
+        for (long i = 0; i < m; ++i, c += c_stride)
+          for (long j = 0; j < n; ++j)
+            c[j] = accumulate ? c[j] + acc[i][j] : acc[i][j];
+      }
+
+#ifdef __GNUC__
+      template <class T>
+      void gemm_kernel<T, true>::apply(long kc, T const *a, T const *b, T *c,
+                                       long c_stride, long m, long n,
+                                       bool accumulate)
+      {
+        vector_type acc[mr][2] = {};
+        for (long p = 0; p < kc; ++p, a += mr, b += nr) {
+          vector_type b0, b1;
+          std::memcpy(&b0, b, sizeof(vector_type));
+          std::memcpy(&b1, b + width, sizeof(vector_type));
+#pragma GCC unroll 8
+          for (long i = 0; i < mr; ++i) {
+            acc[i][0] += a[i] * b0;
+            acc[i][1] += a[i] * b1;
+          }
+        }
+        for (long i = 0; i < m; ++i, c += c_stride) {
+          T tile[nr];
+          std::memcpy(tile, acc[i], sizeof(tile));
+          for (long j = 0; j < n; ++j)
+            c[j] = accumulate ? c[j] + tile[j] : tile[j];
+        }
+      }
+#endif
+
+      /* dst[p * size + j] = src[p * outer + j * inner] for ``p'' in [0,
+       * depth) and ``j'' in [0, width), and 0 for ``j'' in [width, size)
+       */
+      template <class T, class U>
+      void gemm_pack(T const *src, long inner, long outer, long width,
+                     long size, long depth, U *dst)
+      {
+        for (long p = 0; p < depth; ++p, src += outer, dst += size) {
+          for (long j = 0; j < width; ++j)
+            dst[j] = src[j * inner];
+          std::fill(dst + width, dst + size, U());
+        }
+      }
+
+      long gemm_round_up(long value, long multiple)
+      {
+        return (value + multiple - 1) / multiple * multiple;
+      }
+    }
+
+    template <class A, class B, class C>
+    void gemm(long m, long n, long k, A const *a, long a_rs, long a_cs,
+              B const *b, long b_rs, long b_cs, C *c, long c_stride)
+    {
+      if (m == 0 or n == 0)
+        return;
+      if (k == 0) {
+        for (long i = 0; i < m; ++i)
+          std::fill(c + i * c_stride, c + i * c_stride + n, C());
+        return;
+      }
+
+      using kernel = details::gemm_kernel<C>;
+      long const mr = kernel::mr, nr = kernel::nr;
+      long const kc = std::min<long>(PYTHRAN_GEMM_KC, k);
+      long const nc =
+          details::gemm_round_up(std::min<long>(PYTHRAN_GEMM_NC, n), nr);
+      long mc = details::gemm_round_up(std::min<long>(PYTHRAN_GEMM_MC, m), mr);
+      bool const parallel =
+          double(m) * n * k >= PYTHRAN_GEMM_PARALLEL_THRESHOLD;
+#ifdef _OPENMP
+      // give a block of rows to each thread, even for short matrices
+      if (parallel)
+        mc = std::min(mc, details::gemm_round_up(
+                              (m + omp_get_max_threads() - 1) /
+                                  omp_get_max_threads(),
+                              mr));
+#endif
+      long const nb_row_blocks = (m + mc - 1) / mc;
+      std::vector<C> packed_b(nc * kc);
+
+#ifdef _OPENMP
+#pragma omp parallel if (parallel)
+#endif
+      {
+        std::vector<C> packed_a(mc * kc);
+        for (long jc = 0; jc < n; jc += nc) {
+          long const nb = std::min(nc, n - jc);
+          long const nb_slivers = (nb + nr - 1) / nr;
+          for (long pc = 0; pc < k; pc += kc) {
+            long const kb = std::min(kc, k - pc);
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for (long s = 0; s < nb_slivers; ++s)
+              details::gemm_pack(b + pc * b_rs + (jc + s * nr) * b_cs, b_cs,
+                                 b_rs, std::min(nr, nb - s * nr), nr, kb,
+                                 packed_b.data() + s * nr * kb);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (long ib = 0; ib < nb_row_blocks; ++ib) {
+              long const ic = ib * mc;
+              long const mb = std::min(mc, m - ic);
+              for (long ir = 0; ir < mb; ir += mr)
+                details::gemm_pack(a + (ic + ir) * a_rs + pc * a_cs, a_rs,
+                                   a_cs, std::min(mr, mb - ir), mr, kb,
+                                   packed_a.data() + ir * kb);
+              for (long jr = 0; jr < nb; jr += nr)
+                for (long ir = 0; ir < mb; ir += mr)
+                  kernel::apply(kb, packed_a.data() + ir * kb,
+                                packed_b.data() + jr * kb,
+                                c + (ic + ir) * c_stride + jc + jr, c_stride,
+                                std::min(mr, mb - ir), std::min(nr, nb - jr),
+                                pc != 0);
+            }
+          }
+        }
+      }
+    }
+
+    template <class A, class X, class Y>
+    void gemv(long m, long n, A const *a, long a_rs, long a_cs, X const *x,
+              long x_stride, Y *y)
+    {
+      if (std::labs(a_rs) < std::labs(a_cs)) {
+        // columns are contiguous: accumulate them, which vectorizes
+        std::fill(y, y + m, Y());
+        for (long j = 0; j < n; ++j) {
+          Y const xj = x[j * x_stride];
+          A const *column = a + j * a_cs;
+          for (long i = 0; i < m; ++i)
+            y[i] += Y(column[i * a_rs]) * xj;
+        }
+      } else {
+#ifdef _OPENMP
+#pragma omp parallel for if (double(m) * n >=                                 \
+                             PYTHRAN_GEMM_PARALLEL_THRESHOLD)
+#endif
+        for (long i = 0; i < m; ++i) {
+          A const *row = a + i * a_rs;
+          Y acc = Y();
+          for (long j = 0; j < n; ++j)
+            acc += Y(row[j * a_cs]) * Y(x[j * x_stride]);
+          y[i] = acc;
+        }
+      }
+    }
+  }
+}
+
+#endif
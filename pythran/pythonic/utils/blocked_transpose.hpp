@@ -0,0 +1,238 @@
+#ifndef PYTHONIC_UTILS_BLOCKED_TRANSPOSE_HPP
+#define PYTHONIC_UTILS_BLOCKED_TRANSPOSE_HPP
+
+#include "pythonic/include/utils/blocked_transpose.hpp"
+
+#include "pythonic/types/tuple.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      template <size_t Size>
+      template <class T>
+      void transpose_kernel<Size>::apply(T const *src, long src_stride,
+                                         T *dst, long dst_stride)
+      {
+        *dst = *src;
+      }
+
+#if defined(__AVX__)
+      template <class T>
+      void transpose_kernel<4>::apply(T const *src, long src_stride, T *dst,
+                                      long dst_stride)
+      {
+        float const *s = reinterpret_cast<float const *>(src);
+        float *d = reinterpret_cast<float *>(dst);
+        __m256 r0 = _mm256_loadu_ps(s + 0 * src_stride);
+        __m256 r1 = _mm256_loadu_ps(s + 1 * src_stride);
+        __m256 r2 = _mm256_loadu_ps(s + 2 * src_stride);
+        __m256 r3 = _mm256_loadu_ps(s + 3 * src_stride);
+        __m256 r4 = _mm256_loadu_ps(s + 4 * src_stride);
+        __m256 r5 = _mm256_loadu_ps(s + 5 * src_stride);
+        __m256 r6 = _mm256_loadu_ps(s + 6 * src_stride);
+        __m256 r7 = _mm256_loadu_ps(s + 7 * src_stride);
+        // interleave pairs of rows
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+        // gather 4x4 squares in each 128 bits lane
+        r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+        // then swap the lanes
+        _mm256_storeu_ps(d + 0 * dst_stride,
+                         _mm256_permute2f128_ps(r0, r4, 0x20));
+        _mm256_storeu_ps(d + 1 * dst_stride,
+                         _mm256_permute2f128_ps(r1, r5, 0x20));
+        _mm256_storeu_ps(d + 2 * dst_stride,
+                         _mm256_permute2f128_ps(r2, r6, 0x20));
+        _mm256_storeu_ps(d + 3 * dst_stride,
+                         _mm256_permute2f128_ps(r3, r7, 0x20));
+        _mm256_storeu_ps(d + 4 * dst_stride,
+                         _mm256_permute2f128_ps(r0, r4, 0x31));
+        _mm256_storeu_ps(d + 5 * dst_stride,
+                         _mm256_permute2f128_ps(r1, r5, 0x31));
+        _mm256_storeu_ps(d + 6 * dst_stride,
+                         _mm256_permute2f128_ps(r2, r6, 0x31));
+        _mm256_storeu_ps(d + 7 * dst_stride,
+                         _mm256_permute2f128_ps(r3, r7, 0x31));
+      }
+
+      template <class T>
+      void transpose_kernel<8>::apply(T const *src, long src_stride, T *dst,
+                                      long dst_stride)
+      {
+        double const *s = reinterpret_cast<double const *>(src);
+        double *d = reinterpret_cast<double *>(dst);
+        __m256d r0 = _mm256_loadu_pd(s + 0 * src_stride);
+        __m256d r1 = _mm256_loadu_pd(s + 1 * src_stride);
+        __m256d r2 = _mm256_loadu_pd(s + 2 * src_stride);
+        __m256d r3 = _mm256_loadu_pd(s + 3 * src_stride);
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+        _mm256_storeu_pd(d + 0 * dst_stride,
+                         _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(d + 1 * dst_stride,
+                         _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(d + 2 * dst_stride,
+                         _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(d + 3 * dst_stride,
+                         _mm256_permute2f128_pd(t1, t3, 0x31));
+      }
+#elif defined(__SSE2__)
+      template <class T>
+      void transpose_kernel<4>::apply(T const *src, long src_stride, T *dst,
+                                      long dst_stride)
+      {
+        float const *s = reinterpret_cast<float const *>(src);
+        float *d = reinterpret_cast<float *>(dst);
+        __m128 r0 = _mm_loadu_ps(s + 0 * src_stride);
+        __m128 r1 = _mm_loadu_ps(s + 1 * src_stride);
+        __m128 r2 = _mm_loadu_ps(s + 2 * src_stride);
+        __m128 r3 = _mm_loadu_ps(s + 3 * src_stride);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(d + 0 * dst_stride, r0);
+        _mm_storeu_ps(d + 1 * dst_stride, r1);
+        _mm_storeu_ps(d + 2 * dst_stride, r2);
+        _mm_storeu_ps(d + 3 * dst_stride, r3);
+      }
+
+      template <class T>
+      void transpose_kernel<8>::apply(T const *src, long src_stride, T *dst,
+                                      long dst_stride)
+      {
+        double const *s = reinterpret_cast<double const *>(src);
+        double *d = reinterpret_cast<double *>(dst);
+        __m128d r0 = _mm_loadu_pd(s);
+        __m128d r1 = _mm_loadu_pd(s + src_stride);
+        _mm_storeu_pd(d, _mm_unpacklo_pd(r0, r1));
+        _mm_storeu_pd(d + dst_stride, _mm_unpackhi_pd(r0, r1));
+      }
+#endif
+
+      template <class T, class U>
+      void transpose_tile(T const *src, long src_stride, U *dst,
+                          long dst_stride, long r0, long r1, long c0, long c1,
+                          std::false_type)
+      {
+        for (long r = r0; r < r1; ++r)
+          for (long c = c0; c < c1; ++c)
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+      }
+
+      template <class T>
+      void transpose_tile(T const *src, long src_stride, T *dst,
+                          long dst_stride, long r0, long r1, long c0, long c1,
+                          std::true_type)
+      {
+        using kernel = transpose_kernel<sizeof(T)>;
+        long const k = kernel::size;
+        long r = r0;
+        for (; r + k <= r1; r += k) {
+          long c = c0;
+          for (; c + k <= c1; c += k)
+            kernel::apply(src + r * src_stride + c, src_stride,
+                          dst + c * dst_stride + r, dst_stride);
+          transpose_tile(src, src_stride, dst, dst_stride, r, r + k, c, c1,
+                         std::false_type());
+        }
+        transpose_tile(src, src_stride, dst, dst_stride, r, r1, c0, c1,
+                       std::false_type());
+      }
+    }
+
+    template <class T, class U>
+    void transpose(T const *src, long src_stride, U *dst, long dst_stride,
+                   long rows, long cols)
+    {
+      long const block = PYTHRAN_TRANSPOSE_BLOCK;
+      for (long r = 0; r < rows; r += block) {
+        long r1 = std::min(r + block, rows);
+        for (long c = 0; c < cols; c += block)
+          details::transpose_tile(src, src_stride, dst, dst_stride, r, r1, c,
+                                  std::min(c + block, cols),
+                                  details::has_transpose_kernel<T, U>());
+      }
+    }
+
+    template <class T, class U, size_t N>
+    void permute_axes(T const *src, types::array<long, N> const &shape,
+                      long const *axes, U *dst)
+    {
+      // strides of both arrays, indexed by the axes of ``src''
+      types::array<long, N> src_strides, dst_strides;
+      long src_stride = 1, dst_stride = 1;
+      for (long i = N - 1; i >= 0; --i) {
+        src_strides[i] = src_stride;
+        src_stride *= shape[i];
+        dst_strides[axes[i]] = dst_stride;
+        dst_stride *= shape[axes[i]];
+      }
+      if (src_stride == 0)
+        return;
+
+      // ``src'' is contiguous along ``inner'', ``dst'' along ``outer''. The
+      // plane they form is transposed at once, the other axes are walked
+      // as an odometer.
+      long const inner = N - 1, outer = axes[N - 1];
+      long others[N];
+      long nothers = 0;
+      for (long i = 0; i < long(N); ++i)
+        if (i != inner and i != outer)
+          others[nothers++] = i;
+
+      types::array<long, N> index;
+      std::fill(index.begin(), index.end(), 0);
+      long src_offset = 0, dst_offset = 0;
+      while (true) {
+        if (inner == outer)
+          std::copy(src + src_offset, src + src_offset + shape[inner],
+                    dst + dst_offset);
+        else
+          transpose(src + src_offset, src_strides[outer], dst + dst_offset,
+                    dst_strides[inner], shape[outer], shape[inner]);
+
+        long k = nothers - 1;
+        for (; k >= 0; --k) {
+          long axis = others[k];
+          src_offset += src_strides[axis];
+          dst_offset += dst_strides[axis];
+          if (++index[axis] < shape[axis])
+            break;
+          src_offset -= src_strides[axis] * shape[axis];
+          dst_offset -= dst_strides[axis] * shape[axis];
+          index[axis] = 0;
+        }
+        if (k < 0)
+          break;
+      }
+    }
+  }
+}
+
+#endif
@@ -4,6 +4,15 @@
 #include "pythonic/include/utils/broadcast_copy.hpp"
 
 #include "pythonic/types/tuple.hpp"
+#include "pythonic/utils/allocate.hpp"
+#include "pythonic/utils/blocked_transpose.hpp"
+
+#include <functional>
+
+#ifdef USE_BOOST_SIMD
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#endif
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -78,6 +87,78 @@ namespace pythonic
     }
 
 #ifdef USE_BOOST_SIMD
+    namespace details
+    {
+      /* select aligned or unaligned vector memory accesses
+       */
+      template <bool aligned>
+      struct simd_memory;
+
+      template <>
+      struct simd_memory<true> {
+        template <class vT, class T>
+        static vT load(T const *ptr)
+        {
+          return boost::simd::aligned_load<vT>(ptr);
+        }
+        template <class V, class T>
+        static void store(V const &v, T *ptr)
+        {
+          boost::simd::aligned_store(v, ptr);
+        }
+      };
+
+      template <>
+      struct simd_memory<false> {
+        template <class vT, class T>
+        static vT load(T const *ptr)
+        {
+          return boost::simd::load<vT>(ptr);
+        }
+        template <class V, class T>
+        static void store(V const &v, T *ptr)
+        {
+          boost::simd::store(v, ptr);
+        }
+      };
+
+      template <bool aligned, class T, class Iter>
+      void vcopy(T *sbuffer, Iter oiter, long bound)
+      {
+        using vT = typename boost::simd::pack<T>;
+        static const std::size_t vN = vT::static_size;
+#ifdef _OPENMP
+        if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+          for (long i = 0; i < bound; ++i)
+            simd_memory<aligned>::store(*(oiter + i), sbuffer + i * vN);
+        else
+#endif
+          for (long i = 0; i < bound * vN; i += vN, ++oiter)
+            simd_memory<aligned>::store(*oiter, sbuffer + i);
+      }
+
+      template <bool aligned, class Op, class T, class Iter>
+      void vupdate(T *sbuffer, Iter oiter, long bound)
+      {
+        using vT = typename boost::simd::pack<T>;
+        static const std::size_t vN = vT::static_size;
+        using memory = simd_memory<aligned>;
+#ifdef _OPENMP
+        if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+          for (long i = 0; i < bound; ++i)
+            memory::store(
+                Op{}(memory::template load<vT>(sbuffer + i * vN), *(oiter + i)),
+                sbuffer + i * vN);
+        else
+#endif
+          for (long i = 0; i < bound * vN; i += vN, ++oiter)
+            memory::store(Op{}(memory::template load<vT>(sbuffer + i), *oiter),
+                          sbuffer + i);
+      }
+    }
+
     // specialize for SIMD only if available
     // otherwise use the std::copy fallback
     template <class E, class F>
@@ -91,19 +172,15 @@ namespace pythonic
       if (other_size > 0) // empty array sometimes happen when filtering
       {
         static const std::size_t vN = vT::static_size;
-        auto oiter = other.vbegin();
         const long bound = std::distance(other.vbegin(), other.vend());
 
-#ifdef _OPENMP
-        if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
-#pragma omp parallel for
-          for (long i = 0; i < bound; ++i) {
-            self.store(*(oiter + i), i * vN);
-          }
+        // buffers from utils::allocate are aligned, but views and arrays
+        // coming from numpy may not be
+        T *sbuffer = &*self.begin();
+        if (utils::is_aligned(sbuffer, vT::alignment))
+          details::vcopy<true>(sbuffer, other.vbegin(), bound);
         else
-#endif
-          for (long i = 0; i < bound * vN; i += vN, ++oiter)
-            self.store(*oiter, i);
+          details::vcopy<false>(sbuffer, other.vbegin(), bound);
         // tail
         {
           auto siter = self.begin();
@@ -129,10 +206,361 @@ namespace pythonic
 
 #endif
 
+#ifdef USE_BOOST_SIMD
+    namespace details
+    {
+      template <class E>
+      bool no_broadcast(E const &e, long size)
+      {
+        return e.flat_size() == size;
+      }
+
+      template <class T, class B>
+      bool no_broadcast(types::broadcast<T, B> const &, long)
+      {
+        return true;
+      }
+
+      template <class Op, class... Args>
+      bool no_broadcast(types::numpy_expr<Op, Args...> const &e, long size)
+      {
+        return no_broadcast(e.args, size, utils::int_<sizeof...(Args)>());
+      }
+
+      template <class Tuple>
+      bool no_broadcast(Tuple const &, long, utils::int_<0>)
+      {
+        return true;
+      }
+
+      template <class Tuple, size_t I>
+      bool no_broadcast(Tuple const &args, long size, utils::int_<I>)
+      {
+        return no_broadcast(std::get<I - 1>(args), size) and
+               no_broadcast(args, size, utils::int_<I - 1>());
+      }
+
+      template <class T, size_t N>
+      T flat_get(types::ndarray<T, N> const &e, long i)
+      {
+        return e.buffer[i];
+      }
+
+      template <class Arg>
+      typename types::numpy_iexpr<Arg>::dtype
+      flat_get(types::numpy_iexpr<Arg> const &e, long i)
+      {
+        return e.buffer[i];
+      }
+
+      template <class T, class B>
+      typename types::broadcast<T, B>::dtype
+      flat_get(types::broadcast<T, B> const &e, long)
+      {
+        return e._base._value;
+      }
+
+      template <class Op, class... Args, int... I>
+      typename types::numpy_expr<Op, Args...>::dtype
+      flat_get(types::numpy_expr<Op, Args...> const &e, long i,
+               utils::seq<I...>)
+      {
+        return Op{}(flat_get(std::get<I>(e.args), i)...);
+      }
+
+      template <class Op, class... Args>
+      typename types::numpy_expr<Op, Args...>::dtype
+      flat_get(types::numpy_expr<Op, Args...> const &e, long i)
+      {
+        return flat_get(e, i, typename utils::gens<sizeof...(Args)>::type{});
+      }
+
+      template <bool aligned, class T, class F>
+      void flat_vcopy(T *sbuffer, F const &other, long size)
+      {
+        using vT = typename boost::simd::pack<T>;
+        static const long vN = vT::static_size;
+        const long bound = size / vN;
+#ifdef _OPENMP
+        if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+          for (long i = 0; i < bound; ++i)
+            simd_memory<aligned>::store(other.load(i * vN), sbuffer + i * vN);
+        else
+#endif
+          for (long i = 0; i < bound * vN; i += vN)
+            simd_memory<aligned>::store(other.load(i), sbuffer + i);
+        // tail
+        for (long i = bound * vN; i < size; ++i)
+          sbuffer[i] = flat_get(other, i);
+      }
+
+      template <bool aligned, class Op, class T, class F>
+      void flat_vupdate(T *sbuffer, F const &other, long size)
+      {
+        using vT = typename boost::simd::pack<T>;
+        static const long vN = vT::static_size;
+        using memory = simd_memory<aligned>;
+        const long bound = size / vN;
+#ifdef _OPENMP
+        if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
+#pragma omp parallel for
+          for (long i = 0; i < bound; ++i)
+            memory::store(Op{}(memory::template load<vT>(sbuffer + i * vN),
+                               other.load(i * vN)),
+                          sbuffer + i * vN);
+        else
+#endif
+          for (long i = 0; i < bound * vN; i += vN)
+            memory::store(Op{}(memory::template load<vT>(sbuffer + i),
+                               other.load(i)),
+                          sbuffer + i);
+        // tail
+        for (long i = bound * vN; i < size; ++i)
+          sbuffer[i] = Op{}(sbuffer[i], flat_get(other, i));
+      }
+    }
+
+    template <size_t N>
+    template <class E, class F>
+    void _broadcast_copy<true, N, 0>::operator()(E &&self, F const &other)
+    {
+      flat_copy(std::forward<E>(self), other,
+                utils::int_ < details::is_flat<
+                                  typename std::decay<E>::type>::value and
+                    details::is_flat<F>::value > ());
+    }
+
+    template <size_t N>
+    template <class E, class F>
+    void _broadcast_copy<true, N, 0>::flat_copy(E &&self, F const &other,
+                                                utils::int_<0>)
+    {
+      // row by row, each row assignment being vectorized
+      _broadcast_copy<false, N, 0>{}(std::forward<E>(self), other);
+    }
+
+    template <size_t N>
+    template <class E, class F>
+    void _broadcast_copy<true, N, 0>::flat_copy(E &&self, F const &other,
+                                                utils::int_<1>)
+    {
+      using T = typename F::dtype;
+      using vT = typename boost::simd::pack<T>;
+      long size = self.flat_size();
+      if (size != other.flat_size() or not details::no_broadcast(other, size))
+        return flat_copy(std::forward<E>(self), other, utils::int_<0>());
+      T *sbuffer = &*self.fbegin();
+      if (utils::is_aligned(sbuffer, vT::alignment))
+        details::flat_vcopy<true>(sbuffer, other, size);
+      else
+        details::flat_vcopy<false>(sbuffer, other, size);
+    }
+#endif
+
+    namespace details
+    {
+      template <class T>
+      bool tile_compatible(types::ndarray<T, 1> const &e,
+                           types::array<long, 2> const &shape)
+      {
+        return e.shape()[0] == shape[1];
+      }
+
+      template <class T>
+      bool tile_compatible(types::ndarray<T, 2> const &e,
+                           types::array<long, 2> const &shape)
+      {
+        return e.shape()[0] == shape[0] and e.shape()[1] == shape[1];
+      }
+
+      template <class T>
+      bool tile_compatible(types::numpy_texpr<types::ndarray<T, 2>> const &e,
+                           types::array<long, 2> const &shape)
+      {
+        return e.shape()[0] == shape[0] and e.shape()[1] == shape[1];
+      }
+
+      template <class T, class B>
+      bool tile_compatible(types::broadcast<T, B> const &,
+                           types::array<long, 2> const &)
+      {
+        return true;
+      }
+
+      template <class Op, class... Args>
+      bool tile_compatible(types::numpy_expr<Op, Args...> const &e,
+                           types::array<long, 2> const &shape)
+      {
+        return tile_compatible(e.args, shape,
+                               utils::int_<sizeof...(Args)>());
+      }
+
+      template <class Tuple>
+      bool tile_compatible(Tuple const &, types::array<long, 2> const &,
+                           utils::int_<0>)
+      {
+        return true;
+      }
+
+      template <class Tuple, size_t I>
+      bool tile_compatible(Tuple const &args,
+                           types::array<long, 2> const &shape, utils::int_<I>)
+      {
+        return tile_compatible(std::get<I - 1>(args), shape) and
+               tile_compatible(args, shape, utils::int_<I - 1>());
+      }
+
+      template <class E>
+      bool tile_overlap(E const &, void const *, void const *)
+      {
+        return false;
+      }
+
+      template <class T>
+      bool tile_overlap(types::numpy_texpr<types::ndarray<T, 2>> const &e,
+                        void const *lo, void const *hi)
+      {
+        std::less_equal<void const *> le;
+        return le(e.arg.buffer, hi) and
+               le(lo, e.arg.buffer + e.arg.flat_size() - 1);
+      }
+
+      template <class Op, class... Args>
+      bool tile_overlap(types::numpy_expr<Op, Args...> const &e,
+                        void const *lo, void const *hi)
+      {
+        return tile_overlap(e.args, lo, hi, utils::int_<sizeof...(Args)>());
+      }
+
+      template <class Tuple>
+      bool tile_overlap(Tuple const &, void const *, void const *,
+                        utils::int_<0>)
+      {
+        return false;
+      }
+
+      template <class Tuple, size_t I>
+      bool tile_overlap(Tuple const &args, void const *lo, void const *hi,
+                        utils::int_<I>)
+      {
+        return tile_overlap(std::get<I - 1>(args), lo, hi) or
+               tile_overlap(args, lo, hi, utils::int_<I - 1>());
+      }
+
+      template <class T>
+      T tile_get(types::ndarray<T, 1> const &e, long, long j)
+      {
+        return e.buffer[j];
+      }
+
+      template <class T>
+      T tile_get(types::ndarray<T, 2> const &e, long i, long j)
+      {
+        return e.buffer[i * e.shape()[1] + j];
+      }
+
+      template <class T>
+      T tile_get(types::numpy_texpr<types::ndarray<T, 2>> const &e, long i,
+                 long j)
+      {
+        return e.arg.buffer[j * e.arg.shape()[1] + i];
+      }
+
+      template <class T, class B>
+      typename types::broadcast<T, B>::dtype
+      tile_get(types::broadcast<T, B> const &e, long, long)
+      {
+        return e._base._value;
+      }
+
+      template <class Op, class... Args, int... I>
+      typename types::numpy_expr<Op, Args...>::dtype
+      tile_get(types::numpy_expr<Op, Args...> const &e, long i, long j,
+               utils::seq<I...>)
+      {
+        return Op{}(tile_get(std::get<I>(e.args), i, j)...);
+      }
+
+      template <class Op, class... Args>
+      typename types::numpy_expr<Op, Args...>::dtype
+      tile_get(types::numpy_expr<Op, Args...> const &e, long i, long j)
+      {
+        return tile_get(e, i, j,
+                        typename utils::gens<sizeof...(Args)>::type{});
+      }
+
+      template <class T, class V>
+      void tile_assign::operator()(T &&self, V const &value) const
+      {
+        std::forward<T>(self) = value;
+      }
+
+      template <class E, class F, class Op>
+      bool tiled_apply(E &, F const &, Op const &, std::false_type)
+      {
+        return false;
+      }
+
+      template <class E, class F, class Op>
+      bool tiled_apply(E &self, F const &other, Op const &op, std::true_type)
+      {
+        long const rows = self.shape()[0], cols = self.shape()[1];
+        if (not tile_compatible(other, types::array<long, 2>{{rows, cols}}))
+          return false;
+        if (rows == 0 or cols == 0)
+          return true;
+        // writing to the matrix being transposed would read updated values
+        if (tile_overlap(other, &self.fast(0).fast(0),
+                         &self.fast(rows - 1).fast(cols - 1))) {
+          types::ndarray<typename F::dtype, 2> tmp{other};
+          return tiled_apply(self, tmp, op, std::true_type());
+        }
+        long const block = PYTHRAN_TRANSPOSE_BLOCK;
+        for (long i0 = 0; i0 < rows; i0 += block) {
+          long const i1 = std::min(i0 + block, rows);
+          for (long j0 = 0; j0 < cols; j0 += block) {
+            long const j1 = std::min(j0 + block, cols);
+            for (long i = i0; i < i1; ++i) {
+              auto &&row = self.fast(i);
+              for (long j = j0; j < j1; ++j)
+                op(row.fast(j), tile_get(other, i, j));
+            }
+          }
+        }
+        return true;
+      }
+
+      template <class T, class U>
+      bool tiled_apply(types::ndarray<T, 2> &self,
+                       types::numpy_texpr<types::ndarray<U, 2>> const &other,
+                       tile_assign const &, std::true_type)
+      {
+        auto const &arg = other.arg;
+        if (self.shape()[0] != arg.shape()[1] or
+            self.shape()[1] != arg.shape()[0])
+          return false;
+        if (self.id() == arg.id()) {
+          types::ndarray<U, 2> tmp = arg.copy();
+          utils::transpose(tmp.buffer, arg.shape()[1], self.buffer,
+                           self.shape()[1], arg.shape()[0], arg.shape()[1]);
+        } else
+          utils::transpose(arg.buffer, arg.shape()[1], self.buffer,
+                           self.shape()[1], arg.shape()[0], arg.shape()[1]);
+        return true;
+      }
+    }
+
     template <class E, class F, size_t N, size_t D, bool vector_form>
     E &broadcast_copy(E &self, F const &other)
     {
-      _broadcast_copy<vector_form, N, D>{}(self, other);
+      if (not details::tiled_apply(
+              self, other, details::tile_assign(),
+              std::integral_constant<
+                  bool, N == 2 and D == 0 and
+                            details::use_tiles<
+                                typename std::decay<F>::type>::value>()))
+        _broadcast_copy<vector_form, N, D>{}(self, other);
       return self;
     }
 
@@ -220,19 +648,13 @@ namespace pythonic
       if (other_size > 0) // empty array sometimes happen when filtering
       {
         static const std::size_t vN = vT::static_size;
-        auto oiter = other.vbegin();
         const long bound = std::distance(other.vbegin(), other.vend());
 
-#ifdef _OPENMP
-        if (bound >= PYTHRAN_OPENMP_MIN_ITERATION_COUNT)
-#pragma omp parallel for
-          for (long i = 0; i < bound * vN; i += vN) {
-            self.store(Op{}(self.load(i), *(oiter + i)), i);
-          }
+        T *sbuffer = &*self.begin();
+        if (utils::is_aligned(sbuffer, vT::alignment))
+          details::vupdate<true, Op>(sbuffer, other.vbegin(), bound);
         else
-#endif
-          for (long i = 0; i < bound * vN; i += vN, ++oiter)
-            self.store(Op{}(self.load(i), *oiter), i);
+          details::vupdate<false, Op>(sbuffer, other.vbegin(), bound);
         // tail
         {
           auto siter = self.begin();
@@ -264,10 +686,56 @@ namespace pythonic
 
 #endif
 
+#ifdef USE_BOOST_SIMD
+    template <class Op, size_t N>
+    template <class E, class F>
+    void _broadcast_update<Op, true, N, 0>::operator()(E &&self, F const &other)
+    {
+      flat_update(std::forward<E>(self), other,
+                  utils::int_ < details::is_flat<
+                                    typename std::decay<E>::type>::value and
+                      details::is_flat<F>::value > ());
+    }
+
+    template <class Op, size_t N>
+    template <class E, class F>
+    void _broadcast_update<Op, true, N, 0>::flat_update(E &&self,
+                                                        F const &other,
+                                                        utils::int_<0>)
+    {
+      _broadcast_update<Op, false, N, 0>::operator()(std::forward<E>(self),
+                                                     other);
+    }
+
+    template <class Op, size_t N>
+    template <class E, class F>
+    void _broadcast_update<Op, true, N, 0>::flat_update(E &&self,
+                                                        F const &other,
+                                                        utils::int_<1>)
+    {
+      using T = typename F::dtype;
+      using vT = typename boost::simd::pack<T>;
+      long size = self.flat_size();
+      if (size != other.flat_size() or not details::no_broadcast(other, size))
+        return flat_update(std::forward<E>(self), other, utils::int_<0>());
+      T *sbuffer = &*self.fbegin();
+      if (utils::is_aligned(sbuffer, vT::alignment))
+        details::flat_vupdate<true, Op>(sbuffer, other, size);
+      else
+        details::flat_vupdate<false, Op>(sbuffer, other, size);
+    }
+#endif
+
     template <class Op, class E, class F, size_t N, size_t D, bool vector_form>
     E &broadcast_update(E &self, F const &other)
     {
-      _broadcast_update<Op, vector_form, N, D>{}(self, other);
+      if (not details::tiled_apply(
+              self, other, Op(),
+              std::integral_constant<
+                  bool, N == 2 and D == 0 and
+                            details::use_tiles<
+                                typename std::decay<F>::type>::value>()))
+        _broadcast_update<Op, vector_form, N, D>{}(self, other);
       return self;
     }
   }
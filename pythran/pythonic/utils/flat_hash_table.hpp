@@ -0,0 +1,658 @@
+#ifndef PYTHONIC_UTILS_FLAT_HASH_TABLE_HPP
+#define PYTHONIC_UTILS_FLAT_HASH_TABLE_HPP
+
+#include "pythonic/include/utils/flat_hash_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <tuple>
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+#ifdef __SSE2__
+      unsigned probe_group::match(ctrl_t const *ctrl, ctrl_t h2)
+      {
+        __m128i group = _mm_loadu_si128((__m128i const *)ctrl);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), group));
+      }
+
+      unsigned probe_group::match_empty(ctrl_t const *ctrl)
+      {
+        return match(ctrl, ctrl_empty);
+      }
+
+      unsigned probe_group::match_free(ctrl_t const *ctrl)
+      {
+        // full slots hold 7 bits hashes, the others have their sign bit set
+        return _mm_movemask_epi8(_mm_loadu_si128((__m128i const *)ctrl));
+      }
+#else
+      unsigned probe_group::match(ctrl_t const *ctrl, ctrl_t h2)
+      {
+        unsigned mask = 0;
+        for (size_t i = 0; i < width; ++i)
+          mask |= unsigned(ctrl[i] == h2) << i;
+        return mask;
+      }
+
+      unsigned probe_group::match_empty(ctrl_t const *ctrl)
+      {
+        return match(ctrl, ctrl_empty);
+      }
+
+      unsigned probe_group::match_free(ctrl_t const *ctrl)
+      {
+        unsigned mask = 0;
+        for (size_t i = 0; i < width; ++i)
+          mask |= unsigned(ctrl[i] < 0) << i;
+        return mask;
+      }
+#endif
+
+      unsigned lowest_bit(unsigned mask)
+      {
+#if defined(__GNUC__)
+        return __builtin_ctz(mask);
+#else
+        unsigned n = 0;
+        while (not(mask & 1u)) {
+          mask >>= 1;
+          ++n;
+        }
+        return n;
+#endif
+      }
+
+      unsigned highest_bit(size_t n)
+      {
+#if defined(__GNUC__)
+        return 8 * sizeof(unsigned long long) - 1 -
+               __builtin_clzll((unsigned long long)n);
+#else
+        unsigned r = 0;
+        while (n >>= 1)
+          ++r;
+        return r;
+#endif
+      }
+
+      template <class Value>
+      typename select_first<Value>::type const &select_first<Value>::
+      operator()(Value const &v) const
+      {
+        return v.first;
+      }
+
+      template <class Value>
+      typename select_self<Value>::type const &select_self<Value>::
+      operator()(Value const &v) const
+      {
+        return v;
+      }
+
+#define FLAT_HASH_TABLE                                                        \
+  template <class Value, class KeyOf, class Hash, class Equal>
+#define FLAT_HASH_TABLE_TYPE flat_hash_table<Value, KeyOf, Hash, Equal>
+
+      FLAT_HASH_TABLE
+      Value &FLAT_HASH_TABLE_TYPE::entry::value()
+      {
+        return *reinterpret_cast<Value *>(&storage);
+      }
+
+      FLAT_HASH_TABLE
+      Value const &FLAT_HASH_TABLE_TYPE::entry::value() const
+      {
+        return *reinterpret_cast<Value const *>(&storage);
+      }
+
+      /// internals
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::mix(size_t h)
+      {
+        // many hash functions are the identity on integers, spread their
+        // bits so that both the control bits and the slot are meaningful
+        uint64_t x = (uint64_t)h * 0x9E3779B97F4A7C15ull;
+        return size_t(x ^ (x >> 32));
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::block_of(size_t i)
+      {
+        return (i >> first_block_log) ? highest_bit(i) - first_block_log + 1
+                                      : 0;
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::block_size(size_t b)
+      {
+        return size_t(1) << (first_block_log + (b ? b - 1 : 0));
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::entry &FLAT_HASH_TABLE_TYPE::at(size_t i)
+      {
+        size_t b = block_of(i);
+        return blocks_[b][b ? i - block_size(b) : i];
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::entry const &
+      FLAT_HASH_TABLE_TYPE::at(size_t i) const
+      {
+        size_t b = block_of(i);
+        return blocks_[b][b ? i - block_size(b) : i];
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::entry *
+      FLAT_HASH_TABLE_TYPE::find_entry(key_type const &key, size_t h) const
+      {
+        if (not capacity_)
+          return nullptr;
+        ctrl_t h2 = h & 0x7f;
+        size_t group_mask = capacity_ / probe_group::width - 1;
+        size_t group = (h >> 7) & group_mask;
+        // triangular probing visits every group once
+        for (size_t step = 1;; ++step) {
+          ctrl_t const *ctrl = ctrl_.get() + group * probe_group::width;
+          for (unsigned mask = probe_group::match(ctrl, h2); mask;
+               mask &= mask - 1) {
+            entry *e = slots_[group * probe_group::width + lowest_bit(mask)];
+            if (e->hash == h and Equal()(KeyOf()(e->value()), key))
+              return e;
+          }
+          if (probe_group::match_empty(ctrl))
+            return nullptr;
+          group = (group + step) & group_mask;
+        }
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::free_slot(size_t h) const
+      {
+        size_t group_mask = capacity_ / probe_group::width - 1;
+        size_t group = (h >> 7) & group_mask;
+        for (size_t step = 1;; ++step) {
+          ctrl_t const *ctrl = ctrl_.get() + group * probe_group::width;
+          if (unsigned mask = probe_group::match_free(ctrl))
+            return group * probe_group::width + lowest_bit(mask);
+          group = (group + step) & group_mask;
+        }
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::new_entry()
+      {
+        if (not free_.empty()) {
+          size_t i = free_.back();
+          free_.pop_back();
+          return i;
+        }
+        size_t b = block_of(nentries_);
+        if (b == blocks_.size())
+          blocks_.emplace_back(new entry[block_size(b)]);
+        at(nentries_).index = dead;
+        return nentries_++;
+      }
+
+      FLAT_HASH_TABLE
+      void FLAT_HASH_TABLE_TYPE::rehash(size_t capacity)
+      {
+        ctrl_.reset(new ctrl_t[capacity]);
+        slots_.reset(new entry *[capacity]);
+        std::memset(ctrl_.get(), ctrl_empty, capacity);
+        capacity_ = capacity;
+        used_ = size_;
+        // entries do not move, only the index is rebuilt
+        for (size_t i = 0; i < nentries_; ++i) {
+          entry &e = at(i);
+          if (e.index != dead) {
+            size_t slot = free_slot(e.hash);
+            ctrl_[slot] = e.hash & 0x7f;
+            slots_[slot] = &e;
+          }
+        }
+      }
+
+      FLAT_HASH_TABLE
+      void FLAT_HASH_TABLE_TYPE::grow_if_needed()
+      {
+        // keep the load factor, tombstones included, below 7/8
+        if ((used_ + 1) * 8 <= capacity_ * 7)
+          return;
+        if ((size_ + 1) * 16 <= capacity_ * 7)
+          rehash(capacity_); // mostly tombstones, clean them up in place
+        else
+          rehash(capacity_ ? 2 * capacity_ : probe_group::width);
+      }
+
+      FLAT_HASH_TABLE
+      void FLAT_HASH_TABLE_TYPE::destroy()
+      {
+        for (size_t i = 0; i < nentries_; ++i) {
+          entry &e = at(i);
+          if (e.index != dead) {
+            e.value().~Value();
+            e.index = dead;
+          }
+        }
+      }
+
+      FLAT_HASH_TABLE
+      template <class... Args>
+      std::pair<typename FLAT_HASH_TABLE_TYPE::entry *, bool>
+      FLAT_HASH_TABLE_TYPE::emplace_impl(key_type const &key, Args &&... args)
+      {
+        size_t h = mix(Hash()(key));
+        if (entry *e = find_entry(key, h))
+          return {e, false};
+        return {insert_new(h, std::forward<Args>(args)...), true};
+      }
+
+      FLAT_HASH_TABLE
+      template <class... Args>
+      typename FLAT_HASH_TABLE_TYPE::entry *
+      FLAT_HASH_TABLE_TYPE::insert_new(size_t h, Args &&... args)
+      {
+        grow_if_needed();
+        size_t i = new_entry();
+        entry &e = at(i);
+        try {
+          new (&e.storage) Value(std::forward<Args>(args)...);
+        } catch (...) {
+          free_.push_back(i);
+          throw;
+        }
+        e.hash = h;
+        e.index = i;
+        first_ = std::min(first_, i);
+
+        size_t slot = free_slot(h);
+        used_ += ctrl_[slot] == ctrl_empty;
+        ctrl_[slot] = h & 0x7f;
+        slots_[slot] = &e;
+        ++size_;
+        return &e;
+      }
+
+      /// iterators
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::basic_iterator()
+          : table_(nullptr), index_(0), value_(nullptr)
+      {
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::basic_iterator(T *table,
+                                                                 size_t index)
+          : table_(table), index_(index), value_(nullptr)
+      {
+        // skip dead entries
+        for (; index_ < table_->nentries_; ++index_) {
+          auto &e = table_->at(index_);
+          if (e.index != dead) {
+            value_ = &e.value();
+            break;
+          }
+        }
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::basic_iterator(T *table,
+                                                                 size_t index,
+                                                                 V *value)
+          : table_(table), index_(index), value_(value)
+      {
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      template <class T_, class V_>
+      FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::basic_iterator(
+          basic_iterator<T_, V_> const &other)
+          : table_(other.table_), index_(other.index_), value_(other.value_)
+      {
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      typename FLAT_HASH_TABLE_TYPE::template basic_iterator<T, V>::reference
+          FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::operator*() const
+      {
+        return *value_;
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      typename FLAT_HASH_TABLE_TYPE::template basic_iterator<T, V>::pointer
+          FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::operator->() const
+      {
+        return value_;
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      typename FLAT_HASH_TABLE_TYPE::template basic_iterator<T, V> &
+          FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::operator++()
+      {
+        *this = basic_iterator(table_, index_ + 1);
+        return *this;
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      typename FLAT_HASH_TABLE_TYPE::template basic_iterator<T, V>
+          FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::operator++(int)
+      {
+        basic_iterator self = *this;
+        ++*this;
+        return self;
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      template <class T_, class V_>
+      bool FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::
+      operator==(basic_iterator<T_, V_> const &other) const
+      {
+        return index_ == other.index_;
+      }
+
+      FLAT_HASH_TABLE
+      template <class T, class V>
+      template <class T_, class V_>
+      bool FLAT_HASH_TABLE_TYPE::basic_iterator<T, V>::
+      operator!=(basic_iterator<T_, V_> const &other) const
+      {
+        return index_ != other.index_;
+      }
+
+      /// constructors
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE::flat_hash_table()
+          : ctrl_(), slots_(), capacity_(0), used_(0), blocks_(),
+            nentries_(0), size_(0), first_(0), free_()
+      {
+      }
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE::flat_hash_table(size_t n)
+          : flat_hash_table()
+      {
+        reserve(n);
+      }
+
+      FLAT_HASH_TABLE
+      template <class B, class E>
+      FLAT_HASH_TABLE_TYPE::flat_hash_table(B begin, E end)
+          : flat_hash_table()
+      {
+        insert(begin, end);
+      }
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE::flat_hash_table(std::initializer_list<Value> l)
+          : flat_hash_table()
+      {
+        reserve(l.size());
+        insert(l.begin(), l.end());
+      }
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE::flat_hash_table(flat_hash_table const &other)
+          : flat_hash_table()
+      {
+        reserve(other.size());
+        // keys are known to be distinct, and their hash is kept
+        for (size_t i = other.first_; i < other.nentries_; ++i) {
+          entry const &e = other.at(i);
+          if (e.index != dead)
+            insert_new(e.hash, e.value());
+        }
+      }
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE::flat_hash_table(flat_hash_table &&other)
+          : flat_hash_table()
+      {
+        swap(other);
+      }
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE &FLAT_HASH_TABLE_TYPE::
+      operator=(flat_hash_table other)
+      {
+        swap(other);
+        return *this;
+      }
+
+      FLAT_HASH_TABLE
+      FLAT_HASH_TABLE_TYPE::~flat_hash_table()
+      {
+        destroy();
+      }
+
+      FLAT_HASH_TABLE
+      void FLAT_HASH_TABLE_TYPE::swap(flat_hash_table &other)
+      {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(used_, other.used_);
+        std::swap(blocks_, other.blocks_);
+        std::swap(nentries_, other.nentries_);
+        std::swap(size_, other.size_);
+        std::swap(first_, other.first_);
+        std::swap(free_, other.free_);
+      }
+
+      /// container interface
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::iterator FLAT_HASH_TABLE_TYPE::begin()
+      {
+        return {this, first_};
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::const_iterator
+      FLAT_HASH_TABLE_TYPE::begin() const
+      {
+        return {this, first_};
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::iterator FLAT_HASH_TABLE_TYPE::end()
+      {
+        return {this, nentries_, nullptr};
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::const_iterator
+      FLAT_HASH_TABLE_TYPE::end() const
+      {
+        return {this, nentries_, nullptr};
+      }
+
+      FLAT_HASH_TABLE
+      bool FLAT_HASH_TABLE_TYPE::empty() const
+      {
+        return size_ == 0;
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::size() const
+      {
+        return size_;
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::iterator
+      FLAT_HASH_TABLE_TYPE::find(key_type const &key)
+      {
+        if (entry *e = find_entry(key, mix(Hash()(key))))
+          return {this, e->index, &e->value()};
+        return end();
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::const_iterator
+      FLAT_HASH_TABLE_TYPE::find(key_type const &key) const
+      {
+        if (entry const *e = find_entry(key, mix(Hash()(key))))
+          return {this, e->index, &e->value()};
+        return end();
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::count(key_type const &key) const
+      {
+        return find_entry(key, mix(Hash()(key))) != nullptr;
+      }
+
+      FLAT_HASH_TABLE
+      std::pair<typename FLAT_HASH_TABLE_TYPE::iterator, bool>
+      FLAT_HASH_TABLE_TYPE::insert(Value const &value)
+      {
+        auto res = emplace_impl(KeyOf()(value), value);
+        return {iterator(this, res.first->index, &res.first->value()),
+                res.second};
+      }
+
+      FLAT_HASH_TABLE
+      template <class I>
+      void FLAT_HASH_TABLE_TYPE::insert(I begin, I end)
+      {
+        for (; begin != end; ++begin)
+          insert(Value(*begin));
+      }
+
+      FLAT_HASH_TABLE
+      template <class... Args>
+      std::pair<typename FLAT_HASH_TABLE_TYPE::iterator, bool>
+      FLAT_HASH_TABLE_TYPE::try_emplace(key_type const &key, Args &&... args)
+      {
+        auto res = emplace_impl(key, std::forward<Args>(args)...);
+        return {iterator(this, res.first->index, &res.first->value()),
+                res.second};
+      }
+
+      FLAT_HASH_TABLE
+      typename FLAT_HASH_TABLE_TYPE::iterator
+      FLAT_HASH_TABLE_TYPE::erase(const_iterator pos)
+      {
+        size_t i = pos.index_;
+        entry &e = at(i);
+        size_t h = e.hash;
+        ctrl_t h2 = h & 0x7f;
+        size_t group_mask = capacity_ / probe_group::width - 1;
+        size_t group = (h >> 7) & group_mask;
+        for (size_t step = 1;; ++step) {
+          ctrl_t *ctrl = ctrl_.get() + group * probe_group::width;
+          for (unsigned mask = probe_group::match(ctrl, h2); mask;
+               mask &= mask - 1) {
+            size_t slot = group * probe_group::width + lowest_bit(mask);
+            if (slots_[slot] == &e) {
+              // probe sequences stop at groups holding an empty slot, so
+              // such a group needs no tombstone
+              if (probe_group::match_empty(ctrl)) {
+                ctrl_[slot] = ctrl_empty;
+                --used_;
+              } else
+                ctrl_[slot] = ctrl_deleted;
+              e.value().~Value();
+              e.index = dead;
+              free_.push_back(i);
+              --size_;
+              iterator next(this, i);
+              // keeps begin() constant time when popping the first element
+              if (i == first_)
+                first_ = next.index_;
+              return next;
+            }
+          }
+          group = (group + step) & group_mask;
+        }
+      }
+
+      FLAT_HASH_TABLE
+      size_t FLAT_HASH_TABLE_TYPE::erase(key_type const &key)
+      {
+        auto pos = find(key);
+        if (pos == end())
+          return 0;
+        erase(pos);
+        return 1;
+      }
+
+      FLAT_HASH_TABLE
+      void FLAT_HASH_TABLE_TYPE::clear()
+      {
+        destroy();
+        if (capacity_)
+          std::memset(ctrl_.get(), ctrl_empty, capacity_);
+        used_ = nentries_ = size_ = first_ = 0;
+        free_.clear();
+      }
+
+      FLAT_HASH_TABLE
+      void FLAT_HASH_TABLE_TYPE::reserve(size_t n)
+      {
+        size_t capacity = probe_group::width;
+        while (capacity * 7 < n * 8)
+          capacity *= 2;
+        if (capacity > capacity_)
+          rehash(capacity);
+      }
+
+#undef FLAT_HASH_TABLE
+#undef FLAT_HASH_TABLE_TYPE
+    }
+
+    template <class K, class V, class Hash, class Equal>
+    V &flat_hash_map<K, V, Hash, Equal>::operator[](K const &key)
+    {
+      // the mapped value is only built on a miss, lookups do not allocate
+      return this->try_emplace(key, std::piecewise_construct,
+                               std::forward_as_tuple(key),
+                               std::forward_as_tuple()).first->second;
+    }
+
+    template <class T, class Hash, class Equal>
+    typename flat_hash_set<T, Hash, Equal>::iterator
+    flat_hash_set<T, Hash, Equal>::begin() const
+    {
+      return base_type::begin();
+    }
+
+    template <class T, class Hash, class Equal>
+    typename flat_hash_set<T, Hash, Equal>::iterator
+    flat_hash_set<T, Hash, Equal>::end() const
+    {
+      return base_type::end();
+    }
+
+    template <class T, class Hash, class Equal>
+    typename flat_hash_set<T, Hash, Equal>::iterator
+    flat_hash_set<T, Hash, Equal>::find(T const &key) const
+    {
+      return base_type::find(key);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef PYTHONIC_UTILS_PHILOX_HPP
+#define PYTHONIC_UTILS_PHILOX_HPP
+
+#include "pythonic/include/utils/philox.hpp"
+
+#include <algorithm>
+#include <random>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    philox4x32::philox4x32(uint64_t seed, uint64_t stream, uint64_t position)
+        : key{uint32_t(seed), uint32_t(seed >> 32)},
+          counter{uint32_t(position), uint32_t(position >> 32),
+                  uint32_t(stream), uint32_t(stream >> 32)},
+          output{}, index(4)
+    {
+    }
+
+    philox4x32::result_type philox4x32::operator()()
+    {
+      if (index == 4) {
+        uint32_t c[4] = {counter[0], counter[1], counter[2], counter[3]};
+        uint32_t k[2] = {key[0], key[1]};
+        for (int round = 0; round < 10; ++round) {
+          uint64_t p0 = uint64_t(0xD2511F53) * c[0];
+          uint64_t p1 = uint64_t(0xCD9E8D57) * c[2];
+          uint32_t next[4] = {uint32_t(p1 >> 32) ^ c[1] ^ k[0], uint32_t(p1),
+                              uint32_t(p0 >> 32) ^ c[3] ^ k[1], uint32_t(p0)};
+          std::copy(next, next + 4, c);
+          k[0] += 0x9E3779B9;
+          k[1] += 0xBB67AE85;
+        }
+        std::copy(c, c + 4, output);
+        if (++counter[0] == 0)
+          ++counter[1];
+        index = 0;
+      }
+      return output[index++];
+    }
+
+    random_state::random_state() : seed(std::random_device()()), epoch(0)
+    {
+    }
+
+    void random_state::reseed(uint64_t value)
+    {
+      seed = value;
+      ++epoch;
+    }
+
+    namespace details
+    {
+      uint64_t thread_num()
+      {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+      }
+    }
+
+    thread_random::thread_random() : epoch(-1), seed(0), nb_fills(0)
+    {
+    }
+
+    void thread_random::sync(random_state const &state)
+    {
+      if (epoch == state.epoch)
+        return;
+      epoch = state.epoch;
+      seed = state.seed;
+      nb_fills = 0;
+      // scalar streams have the top bit set, fill streams do not
+      generator = philox4x32(seed, (uint64_t(1) << 63) | details::thread_num());
+    }
+
+    template <class T, class Draw>
+    void random_fill(thread_random &local, T *first, long size,
+                     Draw const &draw)
+    {
+      uint64_t const stream = (details::thread_num() << 40) | ++local.nb_fills;
+      uint64_t const seed = local.seed;
+      long const nb_blocks = (size + PYTHRAN_RANDOM_BLOCK - 1) /
+                             PYTHRAN_RANDOM_BLOCK;
+#ifdef _OPENMP
+#pragma omp parallel for if (nb_blocks > 1)
+#endif
+      for (long block = 0; block < nb_blocks; ++block) {
+        // each block gets 2**32 values of the stream
+        philox4x32 generator(seed, stream, uint64_t(block) << 32);
+        Draw block_draw(draw);
+        T *iter = first + block * PYTHRAN_RANDOM_BLOCK;
+        T *end = first + std::min<long>(size, (block + 1) *
+                                                  PYTHRAN_RANDOM_BLOCK);
+        for (; iter != end; ++iter)
+          *iter = block_draw(generator);
+      }
+    }
+  }
+}
+
+#endif
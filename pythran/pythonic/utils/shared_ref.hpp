@@ -6,7 +6,7 @@
 #include <memory>
 #include <utility>
 #include <unordered_map>
-#ifdef _OPENMP
+#if defined(_OPENMP) || defined(PYTHRAN_NOGIL)
 #include <atomic>
 #endif
 
@@ -102,6 +102,12 @@ namespace pythonic
       return mem != other.mem;
     }
 
+    template <class T>
+    bool shared_ref<T>::unique() const noexcept
+    {
+      return mem->count == 1;
+    }
+
     template <class T>
     void shared_ref<T>::external(extern_type obj_ptr)
     {
@@ -128,7 +134,11 @@ namespace pythonic
       if (mem and --mem->count == 0) {
         if (mem->foreign) {
 #ifdef ENABLE_PYTHON_MODULE
+          // the last reference may be dropped by a function running
+          // without the GIL
+          PyGILState_STATE gil = PyGILState_Ensure();
           Py_DECREF(mem->foreign);
+          PyGILState_Release(gil);
 #endif
         } else
           delete mem;
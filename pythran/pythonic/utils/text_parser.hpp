@@ -0,0 +1,246 @@
+#ifndef PYTHONIC_UTILS_TEXT_PARSER_HPP
+#define PYTHONIC_UTILS_TEXT_PARSER_HPP
+
+#include "pythonic/include/utils/text_parser.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    bool is_space(char c)
+    {
+      return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == '\v' or
+             c == '\f';
+    }
+
+    char const *skip_spaces(char const *first, char const *last)
+    {
+      while (first != last and is_space(*first))
+        ++first;
+      return first;
+    }
+
+    namespace details
+    {
+      bool is_digit(char c)
+      {
+        return static_cast<unsigned char>(c - '0') < 10;
+      }
+
+      // case insensitive match of ``word'' at the beginning of the range
+      char const *match_word(char const *first, char const *last,
+                             char const *word)
+      {
+        for (; *word; ++word, ++first)
+          if (first == last or (*first | 0x20) != *word)
+            return nullptr;
+        return first;
+      }
+
+      /* Out of range values saturate to the 64 bit range, then get cast to
+       * T, as numpy does through strtoll and strtoull.
+       */
+      template <class T>
+      char const *parse_integer(char const *first, char const *last,
+                                T &value)
+      {
+        char const *iter = first;
+        bool negative = false;
+        if (iter != last and (*iter == '-' or *iter == '+'))
+          negative = *iter++ == '-';
+        char const *digits = iter;
+        uint64_t const limit =
+            std::is_signed<T>::value
+                ? uint64_t(std::numeric_limits<int64_t>::max()) + negative
+                : std::numeric_limits<uint64_t>::max();
+        uint64_t acc = 0;
+        bool overflow = false;
+        for (; iter != last and is_digit(*iter); ++iter) {
+          unsigned digit = *iter - '0';
+          if (acc > (limit - digit) / 10)
+            overflow = true;
+          else
+            acc = acc * 10 + digit;
+        }
+        if (iter == digits)
+          return first;
+        if (overflow)
+          // strtoull does not negate a saturated value
+          value = std::is_signed<T>::value and negative ? T(0 - limit)
+                                                        : T(limit);
+        else
+          value = negative ? T(0 - acc) : T(acc);
+        return iter;
+      }
+
+      /* Exact for up to 19 significant digits and a decimal exponent that
+       * keeps the conversion within a single correctly rounded
+       * multiplication or division (Clinger's fast path), which covers
+       * nearly all the numbers found in data files. Other numbers go
+       * through the classic locale of a stream.
+       */
+      char const *parse_double(char const *first, char const *last,
+                               double &value)
+      {
+        static const double exact_powers[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        char const *iter = first;
+        bool negative = false;
+        if (iter != last and (*iter == '-' or *iter == '+'))
+          negative = *iter++ == '-';
+
+        uint64_t mantissa = 0;
+        int nb_digits = 0;
+        long exponent = 0;
+        bool any = false, truncated = false;
+        for (; iter != last and is_digit(*iter); ++iter, any = true) {
+          if (nb_digits < 19) {
+            mantissa = mantissa * 10 + (*iter - '0');
+            nb_digits += mantissa != 0;
+          } else {
+            ++exponent;
+            truncated |= *iter != '0';
+          }
+        }
+        if (iter != last and *iter == '.') {
+          ++iter;
+          for (; iter != last and is_digit(*iter); ++iter, any = true) {
+            if (nb_digits < 19) {
+              mantissa = mantissa * 10 + (*iter - '0');
+              nb_digits += mantissa != 0;
+              --exponent;
+            } else
+              truncated |= *iter != '0';
+          }
+        }
+
+        if (not any) {
+          double special;
+          char const *end;
+          if ((end = match_word(iter, last, "nan")))
+            special = std::numeric_limits<double>::quiet_NaN();
+          else if ((end = match_word(iter, last, "inf"))) {
+            special = std::numeric_limits<double>::infinity();
+            if (char const *longer = match_word(end, last, "inity"))
+              end = longer;
+          } else
+            return first;
+          value = negative ? -special : special;
+          return end;
+        }
+
+        if (iter != last and (*iter == 'e' or *iter == 'E')) {
+          char const *exp_iter = iter + 1;
+          bool exp_negative = false;
+          if (exp_iter != last and (*exp_iter == '-' or *exp_iter == '+'))
+            exp_negative = *exp_iter++ == '-';
+          if (exp_iter != last and is_digit(*exp_iter)) {
+            long exp_value = 0;
+            for (; exp_iter != last and is_digit(*exp_iter); ++exp_iter)
+              if (exp_value < 100000)
+                exp_value = exp_value * 10 + (*exp_iter - '0');
+            exponent += exp_negative ? -exp_value : exp_value;
+            iter = exp_iter;
+          }
+        }
+
+        if (not truncated and mantissa <= (uint64_t(1) << 53) and
+            -22 <= exponent and exponent <= 22) {
+          double result = mantissa;
+          if (exponent < 0)
+            result /= exact_powers[-exponent];
+          else
+            result *= exact_powers[exponent];
+          value = negative ? -result : result;
+          return iter;
+        }
+
+        std::istringstream iss(std::string(first, iter));
+        iss.imbue(std::locale::classic());
+        if (not(iss >> value)) {
+          // out of range
+          value = exponent > 0 ? std::numeric_limits<double>::infinity() : 0.;
+          if (negative)
+            value = -value;
+        }
+        return iter;
+      }
+
+      template <class T>
+      typename std::enable_if<std::is_integral<T>::value and
+                                  not std::is_same<T, bool>::value,
+                              char const *>::type
+      parse_number(char const *first, char const *last, T &value)
+      {
+        return parse_integer(first, last, value);
+      }
+
+      template <class T>
+      typename std::enable_if<std::is_same<T, bool>::value,
+                              char const *>::type
+      parse_number(char const *first, char const *last, T &value)
+      {
+        long tmp;
+        char const *end = parse_integer(first, last, tmp);
+        value = tmp != 0;
+        return end;
+      }
+
+      template <class T>
+      typename std::enable_if<not std::is_integral<T>::value,
+                              char const *>::type
+      parse_number(char const *first, char const *last, T &value)
+      {
+        double tmp;
+        char const *end = parse_double(first, last, tmp);
+        value = T(tmp);
+        return end;
+      }
+    }
+
+    template <class T>
+    char const *parse_number(char const *first, char const *last, T &value)
+    {
+      return details::parse_number(first, last, value);
+    }
+
+    template <class R, class Pred, class Parse>
+    std::vector<R> parse_chunks(char const *first, char const *last,
+                                Pred const &is_boundary, Parse const &parse)
+    {
+      std::vector<char const *> bounds(1, first);
+      while (last - bounds.back() > PYTHRAN_PARSE_CHUNK_SIZE) {
+        char const *split = std::find_if(
+            bounds.back() + PYTHRAN_PARSE_CHUNK_SIZE, last, is_boundary);
+        if (split == last)
+          break;
+        bounds.push_back(split + 1);
+      }
+      bounds.push_back(last);
+
+      long const nb_chunks = bounds.size() - 1;
+      std::vector<R> results(nb_chunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (nb_chunks > 1)
+#endif
+      for (long i = 0; i < nb_chunks; ++i)
+        results[i] = parse(bounds[i], bounds[i + 1]);
+      return results;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,391 @@
+#ifndef PYTHONIC_UTILS_TIMSORT_HPP
+#define PYTHONIC_UTILS_TIMSORT_HPP
+
+#include "pythonic/include/utils/timsort.hpp"
+
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace pythonic
+{
+
+  namespace utils
+  {
+
+    namespace details
+    {
+      /* Smallest run length, so that n / minrun is a power of two or close
+       * to, which keeps the final merges balanced
+       */
+      long timsort_minrun(long n)
+      {
+        long r = 0;
+        while (n >= 64) {
+          r |= n & 1;
+          n >>= 1;
+        }
+        return n + r;
+      }
+
+      /* Length of the run starting at ``first'', a strictly descending run
+       * being reversed in place so that equal elements keep their order
+       */
+      template <class It, class Compare>
+      long timsort_count_run(It first, It last, Compare &comp)
+      {
+        It curr = first + 1;
+        if (curr == last)
+          return 1;
+        if (comp(*curr, *first)) {
+          while (++curr != last and comp(*curr, *(curr - 1)))
+            ;
+          std::reverse(first, curr);
+        } else
+          while (++curr != last and not comp(*curr, *(curr - 1)))
+            ;
+        return curr - first;
+      }
+
+      // sorts [first, last), knowing that [first, start) is sorted
+      template <class It, class Compare>
+      void timsort_insertion_sort(It first, It last, It start, Compare &comp)
+      {
+        for (; start != last; ++start) {
+          auto pivot = std::move(*start);
+          It pos = std::upper_bound(first, start, pivot, comp);
+          std::move_backward(pos, start, start + 1);
+          *pos = std::move(pivot);
+        }
+      }
+
+      /* Same as std::upper_bound, probing positions 0, 1, 3, 7... first
+       * so that the cost is logarithmic in the distance to the result
+       */
+      template <class It, class T, class Compare>
+      It timsort_gallop_right(T const &key, It first, It last,
+                              Compare &comp)
+      {
+        long const size = last - first;
+        if (size == 0 or comp(key, *first))
+          return first;
+        long last_ofs = 0, ofs = 1;
+        while (ofs < size and not comp(key, first[ofs])) {
+          last_ofs = ofs;
+          ofs = 2 * ofs + 1;
+        }
+        return std::upper_bound(first + last_ofs + 1,
+                                first + std::min(ofs, size), key, comp);
+      }
+
+      // Same as std::lower_bound, galloping as timsort_gallop_right
+      template <class It, class T, class Compare>
+      It timsort_gallop_left(T const &key, It first, It last, Compare &comp)
+      {
+        long const size = last - first;
+        if (size == 0 or not comp(*first, key))
+          return first;
+        long last_ofs = 0, ofs = 1;
+        while (ofs < size and comp(first[ofs], key)) {
+          last_ofs = ofs;
+          ofs = 2 * ofs + 1;
+        }
+        return std::lower_bound(first + last_ofs + 1,
+                                first + std::min(ofs, size), key, comp);
+      }
+
+      /* Merges the sorted runs [base, base + size1) and [base + size1, base +
+       * size1 + size2), the first one being moved to ``buffer'', equal
+       * elements being taken from the first run first.
+       *
+       * Called on reverse iterators with a flipped comparison, it merges
+       * from the end, moving the second run to ``buffer'' instead.
+       */
+      template <class It, class T, class Compare>
+      void timsort_merge(It base, long size1, long size2,
+                         std::vector<T> &buffer, Compare &comp,
+                         long &min_gallop)
+      {
+        buffer.assign(std::make_move_iterator(base),
+                      std::make_move_iterator(base + size1));
+        auto first1 = buffer.begin(), last1 = buffer.end();
+        It first2 = base + size1, last2 = first2 + size2;
+        It dest = base;
+        // invariant: dest + (last1 - first1) == first2
+        while (true) {
+          long wins1 = 0, wins2 = 0;
+          // one element at a time, until a run wins min_gallop times in a row
+          while (true) {
+            if (comp(*first2, *first1)) {
+              *dest++ = std::move(*first2++);
+              wins1 = 0;
+              if (first2 == last2)
+                goto done;
+              if (++wins2 >= min_gallop)
+                break;
+            } else {
+              *dest++ = std::move(*first1++);
+              wins2 = 0;
+              if (first1 == last1)
+                goto done;
+              if (++wins1 >= min_gallop)
+                break;
+            }
+          }
+          // gallop as long as it moves blocks of elements at once
+          do {
+            auto stop1 = timsort_gallop_right(*first2, first1, last1, comp);
+            wins1 = stop1 - first1;
+            dest = std::move(first1, stop1, dest);
+            first1 = stop1;
+            if (first1 == last1)
+              goto done;
+            *dest++ = std::move(*first2++);
+            if (first2 == last2)
+              goto done;
+
+            It stop2 = timsort_gallop_left(*first1, first2, last2, comp);
+            wins2 = stop2 - first2;
+            dest = std::move(first2, stop2, dest);
+            first2 = stop2;
+            if (first2 == last2)
+              goto done;
+            *dest++ = std::move(*first1++);
+            if (first1 == last1)
+              goto done;
+            if (min_gallop > 1)
+              --min_gallop;
+          } while (wins1 >= PYTHRAN_TIMSORT_MIN_GALLOP or
+                   wins2 >= PYTHRAN_TIMSORT_MIN_GALLOP);
+          // penalize leaving galloping mode
+          min_gallop += 2;
+        }
+      done:
+        // what remains of the second run is already in place
+        std::move(first1, last1, dest);
+      }
+
+      template <class Compare>
+      struct timsort_flipped {
+        Compare &comp;
+        template <class A, class B>
+        bool operator()(A const &a, B const &b) const
+        {
+          return comp(b, a);
+        }
+      };
+
+      template <class It, class Compare>
+      timsort_state<It, Compare>::timsort_state(Compare const &comp)
+          : comp(comp), min_gallop(PYTHRAN_TIMSORT_MIN_GALLOP)
+      {
+      }
+
+      template <class It, class Compare>
+      void timsort_state<It, Compare>::merge_at(long i)
+      {
+        It base1 = runs[i].base, base2 = runs[i + 1].base;
+        long size1 = runs[i].size, size2 = runs[i + 1].size;
+        runs[i].size = size1 + size2;
+        runs.erase(runs.begin() + i + 1);
+
+        // elements of the first run already in place
+        It start = std::upper_bound(base1, base2, *base2, comp);
+        size1 -= start - base1;
+        if (size1 == 0)
+          return;
+        // elements of the second run already in place
+        size2 = std::lower_bound(base2, base2 + size2, *(base2 - 1), comp) -
+                base2;
+        if (size2 == 0)
+          return;
+
+        if (size1 <= size2)
+          timsort_merge(start, size1, size2, buffer, comp, min_gallop);
+        else {
+          using reverse_it = std::reverse_iterator<It>;
+          timsort_flipped<Compare> flipped{comp};
+          timsort_merge(reverse_it(base2 + size2), size2, size1, buffer,
+                        flipped, min_gallop);
+        }
+      }
+
+      /* Keeps the run lengths decreasing at least as fast as the Fibonacci
+       * sequence, from the bottom of the stack
+       */
+      template <class It, class Compare>
+      void timsort_state<It, Compare>::merge_collapse()
+      {
+        while (runs.size() > 1) {
+          long n = runs.size() - 2;
+          if ((n > 0 and
+               runs[n - 1].size <= runs[n].size + runs[n + 1].size) or
+              (n > 1 and
+               runs[n - 2].size <= runs[n - 1].size + runs[n].size)) {
+            if (runs[n - 1].size < runs[n + 1].size)
+              --n;
+          } else if (runs[n].size > runs[n + 1].size)
+            break;
+          merge_at(n);
+        }
+      }
+
+      template <class It, class Compare>
+      void timsort_state<It, Compare>::merge_force_collapse()
+      {
+        while (runs.size() > 1) {
+          long n = runs.size() - 2;
+          if (n > 0 and runs[n - 1].size < runs[n + 1].size)
+            --n;
+          merge_at(n);
+        }
+      }
+
+      template <class It, class Compare>
+      void timsort_state<It, Compare>::sort(It first, It last)
+      {
+        long const size = last - first;
+        if (size < 2)
+          return;
+        long const minrun = timsort_minrun(size);
+        for (It curr = first; curr != last;) {
+          long run_size = timsort_count_run(curr, last, comp);
+          if (run_size < minrun) {
+            long const forced = std::min<long>(minrun, last - curr);
+            timsort_insertion_sort(curr, curr + forced, curr + run_size,
+                                   comp);
+            run_size = forced;
+          }
+          runs.push_back(run{curr, run_size});
+          merge_collapse();
+          curr += run_size;
+        }
+        merge_force_collapse();
+      }
+
+      template <class It, class Compare>
+      void sequential_timsort(It first, It last, Compare &comp)
+      {
+        timsort_state<It, Compare>(comp).sort(first, last);
+      }
+
+#ifdef _OPENMP
+      /* The part of the merge of a[0, size_a) and b[0, size_b) written at
+       * out[0, size_a + size_b)
+       */
+      struct merge_slice {
+        long a, size_a, b, size_b, out;
+      };
+
+      /* Splits a merge in independent slices of at most ``grain'' elements.
+       * The larger range is cut in its middle, and the other one at the
+       * rank of the pivot: before the elements equal to it if the pivot
+       * comes from the first range, after them otherwise, so that equal
+       * elements keep their order.
+       */
+      template <class It, class Compare>
+      void split_merge(It src, merge_slice const &slice, long grain,
+                       Compare &comp, std::vector<merge_slice> &slices)
+      {
+        if (slice.size_a + slice.size_b <= grain or slice.size_a == 0 or
+            slice.size_b == 0) {
+          slices.push_back(slice);
+          return;
+        }
+        It a = src + slice.a, b = src + slice.b;
+        long cut_a, cut_b;
+        if (slice.size_a >= slice.size_b) {
+          cut_a = slice.size_a / 2;
+          cut_b = std::lower_bound(b, b + slice.size_b, a[cut_a], comp) - b;
+        } else {
+          cut_b = slice.size_b / 2;
+          cut_a = std::upper_bound(a, a + slice.size_a, b[cut_b], comp) - a;
+        }
+        split_merge(src, merge_slice{slice.a, cut_a, slice.b, cut_b,
+                                     slice.out},
+                    grain, comp, slices);
+        split_merge(src, merge_slice{slice.a + cut_a, slice.size_a - cut_a,
+                                     slice.b + cut_b, slice.size_b - cut_b,
+                                     slice.out + cut_a + cut_b},
+                    grain, comp, slices);
+      }
+
+      template <class It, class Compare>
+      void parallel_timsort(It first, It last, Compare &comp,
+                            long nb_threads)
+      {
+        using value_type = typename std::iterator_traits<It>::value_type;
+        long const size = last - first;
+        std::vector<long> bounds(nb_threads + 1);
+        for (long i = 0; i <= nb_threads; ++i)
+          bounds[i] = size * i / nb_threads;
+
+#pragma omp parallel for schedule(dynamic)
+        for (long i = 0; i < nb_threads; ++i)
+          sequential_timsort(first + bounds[i], first + bounds[i + 1], comp);
+
+        std::vector<value_type> buffer(std::make_move_iterator(first),
+                                       std::make_move_iterator(last));
+        long const grain = std::max(size / (4 * nb_threads), 1L << 12);
+        std::vector<merge_slice> slices;
+        bool in_buffer = true;
+        for (long width = 1; width < nb_threads; width *= 2) {
+          slices.clear();
+          for (long i = 0; i < nb_threads; i += 2 * width) {
+            long const lo = bounds[i],
+                       mid = bounds[std::min(i + width, nb_threads)],
+                       hi = bounds[std::min(i + 2 * width, nb_threads)];
+            if (in_buffer)
+              split_merge(buffer.begin(),
+                          merge_slice{lo, mid - lo, mid, hi - mid, lo}, grain,
+                          comp, slices);
+            else
+              split_merge(first, merge_slice{lo, mid - lo, mid, hi - mid, lo},
+                          grain, comp, slices);
+          }
+          long const nb_slices = slices.size();
+#pragma omp parallel for schedule(dynamic)
+          for (long s = 0; s < nb_slices; ++s) {
+            merge_slice const &slice = slices[s];
+            if (in_buffer) {
+              auto a = buffer.begin() + slice.a, b = buffer.begin() + slice.b;
+              std::merge(std::make_move_iterator(a),
+                         std::make_move_iterator(a + slice.size_a),
+                         std::make_move_iterator(b),
+                         std::make_move_iterator(b + slice.size_b),
+                         first + slice.out, comp);
+            } else {
+              It a = first + slice.a, b = first + slice.b;
+              std::merge(std::make_move_iterator(a),
+                         std::make_move_iterator(a + slice.size_a),
+                         std::make_move_iterator(b),
+                         std::make_move_iterator(b + slice.size_b),
+                         buffer.begin() + slice.out, comp);
+            }
+          }
+          in_buffer = not in_buffer;
+        }
+        if (in_buffer)
+          std::move(buffer.begin(), buffer.end(), first);
+      }
+#endif
+    }
+
+    template <class It, class Compare>
+    void timsort(It first, It last, Compare comp)
+    {
+#ifdef _OPENMP
+      long const nb_threads =
+          std::min<long>(omp_get_max_threads(),
+                         (last - first) / PYTHRAN_PARALLEL_SORT_THRESHOLD);
+      if (nb_threads > 1)
+        return details::parallel_timsort(first, last, comp, nb_threads);
+#endif
+      details::sequential_timsort(first, last, comp);
+    }
+  }
+}
+
+#endif
@@ -1,6 +1,6 @@
 """ Module with facilities to represent range values. """
 
-from math import isinf
+from math import isinf, isnan
 import gast as ast
 import itertools
 
@@ -45,18 +45,18 @@ UNKNOWN_RANGE = Range(-float("inf"), float("inf"))
 def range_values(args):
     """ Function used to compute returned range value of [x]range function. """
     if len(args) == 1:
-        return (0, args[0].high)
+        return Range(0, args[0].high)
     elif len(args) == 2:
-        return (args[0].low, args[1].high)
+        return Range(args[0].low, args[1].high)
     elif len(args) == 3:
         is_neg = args[2].low < 0
         is_pos = args[2].high > 0
         if is_neg and is_pos:
             return UNKNOWN_RANGE
         elif is_neg:
-            return (args[1].low, args[0].high)
+            return Range(args[1].low, args[0].high)
         else:
-            return (args[0].low, args[1].high)
+            return Range(args[0].low, args[1].high)
 
 
 def bool_values(_):
@@ -111,8 +111,12 @@ def combine_mult(range1, range2):
     Range(low=-25, high=15)
     >>> combine(Range(1, 5), Range(3, 8), ast.Mult())
     Range(low=3, high=40)
+    >>> combine(Range(0, float("inf")), Range(0, 2), ast.Mult())
+    Range(low=0.0, high=inf)
     """
-    res = [v1 * v2 for v1, v2 in itertools.product(range1, range2)]
+    # 0 * inf stands for the product of 0 and a large value
+    res = [v1 * v2 if v1 and v2 else 0
+           for v1, v2 in itertools.product(range1, range2)]
     return Range(numpy.min(res), numpy.max(res))
 
 
@@ -286,5 +290,16 @@ COMBINE_DISPATCHER = {
 
 
 def combine(range1, range2, op):
-    """ Combine two range joined by a given operation. """
-    return COMBINE_DISPATCHER[type(op)](range1, range2)
+    """ Combine two range joined by a given operation.
+
+    Undefined bounds, as produced by ``inf / inf``, are widened to infinity.
+
+    >>> import gast as ast
+    >>> combine(Range(1, float("inf")), Range(1, float("inf")), ast.Div())
+    Range(low=-inf, high=inf)
+    """
+    res = COMBINE_DISPATCHER[type(op)](range1, range2)
+    if isnan(res.low) or isnan(res.high):
+        return Range(-float("inf") if isnan(res.low) else res.low,
+                     float("inf") if isnan(res.high) else res.high)
+    return res
@@ -64,8 +64,8 @@ def run():
                         help='similar to -E, '
                              'but does not generate python glue')
 
-    parser.add_argument('-v', dest='verbose', action='store_true',
-                        help='be verbose')
+    parser.add_argument('-v', dest='verbose', action='count', default=0,
+                        help='be verbose, twice to trace optimizations')
 
     parser.add_argument('-V', '--version',
                         action='version',
@@ -102,7 +102,9 @@ def run():
     if args.raw_translate_only:
         args.translate_only = True
 
-    if args.verbose:
+    if args.verbose > 1:
+        logger.setLevel(logging.DEBUG)
+    elif args.verbose:
         logger.setLevel(logging.INFO)
 
     try:
@@ -5,7 +5,7 @@ This module provides a dummy parser for pythran annotations.
 
 from pythran.types.conversion import pytype_to_pretty_type
 
-from numpy import array, ndarray
+from numpy import array, asfortranarray, ndarray
 
 import re
 import os.path
@@ -14,6 +14,14 @@ import ply.yacc as yacc
 from functools import reduce
 
 
+class NoGILSignature(list):
+
+    '''
+    Argument types of an exported signature that runs without holding the
+    Global Interpreter Lock, as in ``#pythran export nogil foo(int)``.
+    '''
+
+
 class SpecParser:
 
     """
@@ -24,12 +32,14 @@ class SpecParser:
 #pythran export a(str)
 #pythran export a( (str,str), int, long list list)
 #pythran export a( {str} )
+#pythran export nogil a(float[])
 """
 
     # lex part
     reserved = {
         '#pythran': 'PYTHRAN',
         'export': 'EXPORT',
+        'nogil': 'NOGIL',
         'list': 'LIST',
         'set': 'SET',
         'dict': 'DICT',
@@ -101,10 +111,17 @@ class SpecParser:
     def p_export(self, p):
         '''export : IDENTIFIER LPAREN opt_types RPAREN
                   | IDENTIFIER
-                  | EXPORT LPAREN opt_types RPAREN'''
+                  | EXPORT LPAREN opt_types RPAREN
+                  | NOGIL LPAREN opt_types RPAREN
+                  | NOGIL IDENTIFIER LPAREN opt_types RPAREN
+                  | NOGIL EXPORT LPAREN opt_types RPAREN
+                  | NOGIL NOGIL LPAREN opt_types RPAREN'''
         # handle the unlikely case where the IDENTIFIER is ...
-        # export :-)
-        if len(p) > 2:
+        # export or nogil :-)
+        if len(p) == 6:
+            signature = NoGILSignature(p[4])
+            self.exports[p[2]] = self.exports.get(p[2], ()) + (signature,)
+        elif len(p) > 2:
             self.exports[p[1]] = self.exports.get(p[1], ()) + (p[3],)
         else:
             self.exports[p[1]] = ()
@@ -117,6 +134,7 @@ class SpecParser:
         '''crap : CRAP
                 | IDENTIFIER
                 | EXPORT
+                | NOGIL
                 | LPAREN
                 | RPAREN
                 | LARRAY
@@ -277,12 +295,20 @@ def expand_specs(specs):
             return [[]]
         elif n == 1:
             arg = args[0]
+            if not isinstance(arg, ndarray):
+                return [[arg]]
+            # strided arrays (``[::]'' in the spec) accept any layout, but
+            # contiguous arrays still get the faster ndarray overload
+            elif any(x < 0 for x in arg.strides):
+                return [[arg.copy()], [arg]]
             # handle f_contiguous storage as a transpose of two elements
-            # currently only supported by pythonic for 2D matrices :-/
-            # the trick is to use an array of two elements and transpose it
+            # the trick is to use an array of two elements per dimension
             # so that its storage becomes f_contiguous only
-            if isinstance(arg, ndarray) and arg.ndim == 2:
-                return [[arg], [arg.repeat(2, axis=0).T]]
+            elif arg.ndim >= 2:
+                fortran = arg
+                for axis in range(arg.ndim):
+                    fortran = fortran.repeat(2, axis=axis)
+                return [[arg], [asfortranarray(fortran)]]
             else:
                 return [[arg]]
         else:
@@ -292,7 +318,10 @@ def expand_specs(specs):
     for function, signatures in specs.items():
         expanded_signatures = []
         for signature in signatures:
-            expanded_signatures.extend(spec_expander(signature))
+            expanded = spec_expander(signature)
+            if isinstance(signature, NoGILSignature):
+                expanded = [NoGILSignature(s) for s in expanded]
+            expanded_signatures.extend(expanded)
         all_specs[function] = tuple(expanded_signatures)
     return all_specs
 
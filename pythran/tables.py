@@ -125,7 +125,8 @@ CLASSES = {
         "index": ConstMethodIntr(),
         "pop": MethodIntr(),
         "reverse": MethodIntr(),
-        "sort": MethodIntr(),
+        "sort": MethodIntr(args=('self', 'cmp', 'key', 'reverse'),
+                           defaults=(None, None, False)),
         "count": ConstMethodIntr(),
         "remove": MethodIntr(),
         "insert": MethodIntr(
@@ -372,7 +373,8 @@ MODULES = {
         "reversed": ReadOnceFunctionIntr(),
         "round": ConstFunctionIntr(),
         "set": ClassWithReadOnceConstructor(CLASSES['set']),
-        "sorted": ConstFunctionIntr(),
+        "sorted": ConstFunctionIntr(args=('iterable', 'cmp', 'key', 'reverse'),
+                                    defaults=(None, None, False)),
         "str": ClassWithConstConstructor(CLASSES['str']),
         "sum": ReadOnceFunctionIntr(),
         "tuple": ReadOnceFunctionIntr(),
@@ -528,6 +530,7 @@ MODULES = {
                                  defaults=(None, None)),
         },
         "linspace": ConstFunctionIntr(),
+        "loadtxt": ConstFunctionIntr(global_effects=True),
         "log": ConstFunctionIntr(),
         "log10": ConstFunctionIntr(),
         "log1p": ConstFunctionIntr(),
@@ -539,6 +542,7 @@ MODULES = {
         "logical_not": ConstFunctionIntr(),
         "logical_or": UFunc(BINARY_UFUNC),
         "logical_xor": UFunc(BINARY_UFUNC),
+        "matmul": ConstFunctionIntr(),
         "max": ConstMethodIntr(),
         "maximum": UFunc(BINARY_UFUNC),
         "mean": ConstMethodIntr(),
@@ -567,6 +571,7 @@ MODULES = {
         "ones": ConstFunctionIntr(),
         "ones_like": ConstFunctionIntr(),
         "outer": ConstFunctionIntr(),
+        "percentile": ConstFunctionIntr(),
         "pi": ConstantIntr(),
         "place": FunctionIntr(),
         "power": UFunc(BINARY_UFUNC),
@@ -575,6 +580,7 @@ MODULES = {
         "ptp": ConstMethodIntr(),
         "put": MethodIntr(),
         "putmask": FunctionIntr(),
+        "quantile": ConstFunctionIntr(),
         "rad2deg": ConstFunctionIntr(),
         "radians": ConstFunctionIntr(),
         "random": {
@@ -603,6 +609,9 @@ MODULES = {
                                           global_effects=True),
             "sample": FunctionIntr(args=('size',),
                                    global_effects=True),
+            "seed": FunctionIntr(args=('seed',),
+                                 defaults=(None,),
+                                 global_effects=True),
             "standard_normal": FunctionIntr(args=('size',),
                                             global_effects=True),
         },
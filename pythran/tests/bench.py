@@ -0,0 +1,248 @@
+"""
+Benchmark suite built from the test cases carrying a ``#bench`` line.
+
+A ``#bench`` line follows the ``#runas`` convention: statements separated by
+``;``, the last one being the workload. Only the workload is timed, the
+previous statements are run before each repetition to set up fresh inputs.
+
+Each case is run in several modes:
+
+python
+    the interpreter running this script
+pythran
+    the module compiled by Pythran
+pythran+omp
+    the module compiled by Pythran in OpenMP mode
+reference
+    the module compiled by Pythran with the ``--reference-flags`` compiler
+    flags, to vet a compiler or a flag change
+
+The median and the variance of the timings are reported as JSON, and can be
+compared against a previous report to detect performance regressions.
+"""
+
+from __future__ import print_function
+
+from imp import load_dynamic
+import argparse
+import glob
+import json
+import os
+import shutil
+import sys
+import tempfile
+import timeit
+
+from pythran import compile_pythrancode
+from pythran.version import __version__
+
+CASES_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "cases")
+BENCH_MARKER = "#bench "
+MODES = ("python", "pythran", "pythran+omp", "reference")
+DEFAULT_MODES = ("python", "pythran")
+DEFAULT_NB_ITER = 11
+DEFAULT_THRESHOLD = 0.1
+
+
+def collect_cases(names=None, path=CASES_DIR):
+    """ Yield (name, code, workload) for each ``#bench`` line of the test
+    cases in ``path``, restricted to the cases listed in ``names`` if any. """
+    for filepath in sorted(glob.glob(os.path.join(path, "*.py"))):
+        name, _ = os.path.splitext(os.path.basename(filepath))
+        if names and name not in names:
+            continue
+        with open(filepath) as source:
+            code = source.read()
+        workloads = [line[len(BENCH_MARKER):].strip()
+                     for line in code.splitlines()
+                     if line.startswith(BENCH_MARKER)]
+        for n, workload in enumerate(workloads):
+            yield (name if n == 0 else "{}_{}".format(name, n)), code, workload
+
+
+def split_workload(workload):
+    """ Split a ``#bench`` line into its setup and its timed statement. """
+    statements = workload.split(";")
+    return ";".join(statements[:-1]), statements[-1].strip()
+
+
+def statistics(timings):
+    """ Median and (sample) variance of ``timings``. """
+    ordered = sorted(timings)
+    size = len(ordered)
+    middle = size // 2
+    if size % 2:
+        median = ordered[middle]
+    else:
+        median = (ordered[middle - 1] + ordered[middle]) / 2.
+    mean = sum(ordered) / float(size)
+    variance = (sum((t - mean) ** 2 for t in ordered) / (size - 1)
+                if size > 1 else 0.)
+    return {"median": median, "variance": variance, "timings": timings}
+
+
+def measure(namespace, workload, nb_iter):
+    """ Time the last statement of ``workload`` ``nb_iter`` times, running
+    the setup statements in a fresh copy of ``namespace`` each time. """
+    setup, statement = split_workload(workload)
+    setup = compile(setup, "<bench setup>", "exec")
+    statement = compile(statement, "<bench>", "exec")
+    timer = timeit.default_timer
+    timings = []
+    for _ in range(nb_iter):
+        env = dict(namespace)
+        exec(setup, env)
+        start = timer()
+        exec(statement, env)
+        timings.append(timer() - start)
+    return statistics(timings)
+
+
+def compile_flags(mode, cxxflags, reference_flags):
+    """ Compiler and linker flags used for ``mode``. """
+    flags = list(cxxflags)
+    if mode == "pythran+omp":
+        flags.append("-fopenmp")
+    elif mode == "reference":
+        flags.extend(reference_flags)
+    return {"extra_compile_args": flags, "extra_link_args": flags}
+
+
+def bench_mode(name, code, workload, mode, nb_iter, cxxflags,
+               reference_flags):
+    """ Timings of a single case in a single mode. """
+    if mode == "python":
+        namespace = {"__name__": name}
+        exec(code, namespace)
+        return measure(namespace, workload, nb_iter)
+    builddir = tempfile.mkdtemp()
+    modname = "{}_{}".format(name, mode.replace("+", "_"))
+    try:
+        module_path = compile_pythrancode(
+            modname, code,
+            output_file=os.path.join(builddir, modname + ".so"),
+            **compile_flags(mode, cxxflags, reference_flags))
+        module = load_dynamic(modname, module_path)
+        return measure(module.__dict__, workload, nb_iter)
+    finally:
+        shutil.rmtree(builddir)
+
+
+def bench_case(name, code, workload, modes, nb_iter, cxxflags,
+               reference_flags):
+    """ Timings of a single case, indexed by mode. A mode that fails to
+    compile or run gets an ``error`` entry instead. """
+    results = {}
+    for mode in modes:
+        try:
+            results[mode] = bench_mode(name, code, workload, mode, nb_iter,
+                                       cxxflags, reference_flags)
+        except Exception as e:
+            results[mode] = {"error": "{}: {}".format(type(e).__name__, e)}
+    python = results.get("python", {}).get("median")
+    if python is not None:
+        for result in results.values():
+            if "median" in result:
+                result["speedup"] = (python / result["median"]
+                                     if result["median"] else float("inf"))
+    return results
+
+
+def compare(report, baseline, threshold):
+    """ List the (case, mode, baseline median, median) that got slower than
+    ``baseline`` by more than ``threshold`` (a ratio). The median is None
+    when the case no longer runs. """
+    regressions = []
+    for name, results in sorted(report["cases"].items()):
+        reference = baseline["cases"].get(name, {})
+        for mode, result in sorted(results.items()):
+            before = reference.get(mode, {}).get("median")
+            if before is None:
+                continue
+            after = result.get("median")
+            if after is None or after > before * (1 + threshold):
+                regressions.append((name, mode, before, after))
+    return regressions
+
+
+def run(names=None, modes=DEFAULT_MODES, nb_iter=DEFAULT_NB_ITER,
+        cxxflags=(), reference_flags=(), path=CASES_DIR, log=sys.stderr):
+    """ Benchmark the cases and return the report, as a dictionary. """
+    report = {"version": __version__,
+              "python": sys.version.split()[0],
+              "nb_iter": nb_iter,
+              "cxxflags": list(cxxflags),
+              "reference_flags": list(reference_flags),
+              "cases": {}}
+    for name, code, workload in collect_cases(names, path):
+        # resolve imports relatively to the test cases, as the tests do
+        sys.path.insert(0, path)
+        try:
+            results = bench_case(name, code, workload, modes, nb_iter,
+                                 cxxflags, reference_flags)
+        finally:
+            sys.path.pop(0)
+        report["cases"][name] = results
+        print("{}: {}".format(name, ", ".join(
+            "{} {}".format(mode, "{:.4f}s".format(results[mode]["median"])
+                           if "median" in results[mode] else
+                           results[mode]["error"])
+            for mode in modes)), file=log)
+    return report
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(
+        description="Benchmark the Pythran test cases with a #bench line.")
+    parser.add_argument("cases", nargs="*",
+                        help="cases to run, all of them if none is given")
+    parser.add_argument("--mode", default=",".join(DEFAULT_MODES),
+                        help="comma separated list among " + ", ".join(MODES))
+    parser.add_argument("--nb-iter", type=int, default=DEFAULT_NB_ITER,
+                        help="number of repetitions of each workload")
+    parser.add_argument("--cxxflags", default="",
+                        help="extra compiler flags for compiled modes")
+    parser.add_argument("--reference-flags", default="",
+                        help="extra compiler flags for the reference mode")
+    parser.add_argument("-o", "--output",
+                        help="write the JSON report there instead of stdout")
+    parser.add_argument("--baseline",
+                        help="JSON report to compare the timings with")
+    parser.add_argument("--threshold", type=float, default=DEFAULT_THRESHOLD,
+                        help="slowdown ratio over the baseline reported as a "
+                             "regression (default {})".format(
+                                 DEFAULT_THRESHOLD))
+    args = parser.parse_args(argv)
+
+    modes = [mode for mode in args.mode.split(",") if mode]
+    for mode in modes:
+        if mode not in MODES:
+            parser.error("unknown mode: " + mode)
+
+    report = run(args.cases, modes, args.nb_iter, args.cxxflags.split(),
+                 args.reference_flags.split())
+
+    dump = json.dumps(report, indent=2, sort_keys=True)
+    if args.output:
+        with open(args.output, "w") as output:
+            output.write(dump)
+    else:
+        print(dump)
+
+    if args.baseline:
+        with open(args.baseline) as baseline:
+            regressions = compare(report, json.load(baseline), args.threshold)
+        for name, mode, before, after in regressions:
+            if after is None:
+                print("{} ({}): {:.4f}s -> failed".format(name, mode, before),
+                      file=sys.stderr)
+            else:
+                print("{} ({}): {:.4f}s -> {:.4f}s, {:+.0%}".format(
+                    name, mode, before, after, after / before - 1),
+                    file=sys.stderr)
+        return 1 if regressions else 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
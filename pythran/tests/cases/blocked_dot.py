@@ -0,0 +1,10 @@
+#pythran export blocked_dot(int[][], int[][], float[][], float[][])
+#runas import numpy as np; a = np.arange(60).reshape(6, 10) % 7; b = np.arange(40).reshape(4, 10) % 5; blocked_dot(a, b, a * 1., b * 1.)
+#bench import numpy as np; n = 600; a = np.arange(n * n).reshape(n, n) % 7; b = np.arange(n * n).reshape(n, n) % 5; blocked_dot(a, b, a * 1., b * 1.)
+
+# The int64 product runs the blocked kernel and the float64 one BLAS, both
+# reading ``b.T'' in place; each one is 600**3 multiply-adds.
+import numpy as np
+
+def blocked_dot(a, b, c, d):
+    return np.dot(a, b.T), np.dot(c, d.T)
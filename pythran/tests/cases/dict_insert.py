@@ -0,0 +1,10 @@
+#pythran export dict_insert(int)
+#runas dict_insert(1000)
+#bench dict_insert(3000000)
+# dict insertion of integer keys, with growth
+
+def dict_insert(n):
+    d = {}
+    for i in xrange(n):
+        d[i * 7919 % n] = i
+    return len(d)
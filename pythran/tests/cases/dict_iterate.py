@@ -0,0 +1,16 @@
+#pythran export dict_iterate(int)
+#runas dict_iterate(1000)
+#bench dict_iterate(1000000)
+# iteration over keys, values and items of a large dict
+
+def dict_iterate(n):
+    d = {i * 7919: float(i) for i in xrange(n)}
+    s = 0.
+    for _ in xrange(10):
+        for k in d:
+            s += k
+        for v in d.itervalues():
+            s += v
+        for k, v in d.iteritems():
+            s += k * v
+    return s
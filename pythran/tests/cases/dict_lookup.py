@@ -0,0 +1,15 @@
+#pythran export dict_lookup(int)
+#runas dict_lookup(1000)
+#bench dict_lookup(1000000)
+# dict lookups, half of them hitting
+
+def dict_lookup(n):
+    d = {}
+    for i in xrange(0, 2 * n, 2):
+        d[i] = i
+    s = 0
+    for _ in xrange(10):
+        for i in xrange(2 * n):
+            if i in d:
+                s += d[i]
+    return s
@@ -0,0 +1,11 @@
+#pythran export dict_str_lookup(int)
+#runas dict_str_lookup(1000)
+#bench dict_str_lookup(2000000)
+# repeated hits on a dict whose values are strings, which must not allocate
+
+def dict_str_lookup(n):
+    d = {i: str(i) for i in xrange(1000)}
+    s = 0
+    for i in xrange(n):
+        s += len(d[i % 1000])
+    return s
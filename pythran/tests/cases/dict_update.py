@@ -0,0 +1,10 @@
+#pythran export dict_update(str list)
+#runas dict_update(["a", "b", "a", "c"] * 10)
+#bench dict_update([str(i % 10007) for i in xrange(3000000)])
+# word count, a lookup followed by an update of the value
+
+def dict_update(words):
+    count = {}
+    for w in words:
+        count[w] = count.get(w, 0) + 1
+    return max(count.values())
@@ -0,0 +1,10 @@
+#pythran export list_comp_poly(float list, float)
+#runas list_comp_poly([x * .5 for x in range(100)], 1.5)
+#bench list_comp_poly([x * .5 for x in range(2000000)], 1.5)
+
+# elementwise comprehensions over a list and over a range, the second one
+# capturing ``a'' through a closure
+def list_comp_poly(l, a):
+    p = [x * x - 3 * x + 1 for x in l]
+    q = [a * i + 2. for i in range(len(l))]
+    return sum(p) + sum(q)
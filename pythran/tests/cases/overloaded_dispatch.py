@@ -0,0 +1,10 @@
+#pythran export overloaded_dispatch(int list)
+#pythran export overloaded_dispatch(float list)
+#pythran export overloaded_dispatch(int)
+#pythran export overloaded_dispatch(float)
+#pythran export overloaded_dispatch(float[])
+#pythran export overloaded_dispatch(float[][])
+#runas overloaded_dispatch([1.5]), overloaded_dispatch([1, 2]), overloaded_dispatch([1.5])
+#runas import numpy as np; a = np.ones((3, 2)); [overloaded_dispatch(x) for x in (1, 1.5, a, a.T, a[0], 2, a, 2.5)]
+def overloaded_dispatch(x):
+    return x
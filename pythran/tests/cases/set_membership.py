@@ -0,0 +1,15 @@
+#pythran export set_membership(int)
+#runas set_membership(1000)
+#bench set_membership(3000000)
+# set membership tests and set operations on large integer sets
+
+def set_membership(n):
+    seen = set(xrange(0, n, 3))
+    other = set(xrange(0, n, 5))
+    hits = 0
+    for _ in xrange(5):
+        for i in xrange(n):
+            if i in seen:
+                hits += 1
+    return (hits, len(seen & other), len(seen | other), len(seen ^ other),
+            len(seen - other))
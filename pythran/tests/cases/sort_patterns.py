@@ -0,0 +1,17 @@
+#pythran export sort_patterns(int list)
+#runas sort_patterns([(i * 7919) % 1009 for i in range(1000)])
+#bench import random; random.seed(0); sort_patterns([random.randint(0, 10 ** 9) for i in range(500000)])
+
+# random, sorted, reversed and partially sorted inputs, the latter three
+# being mostly made of long runs
+def sort_patterns(l):
+    n = len(l)
+    shuffled = list(l)
+    shuffled.sort()
+    ordered = list(shuffled)
+    ordered.sort()
+    backward = sorted(ordered, reverse=True)
+    partial = ordered[n // 10:] + l[:n // 10]
+    partial.sort()
+    by_digit = sorted(l, key=lambda x: x % 10)
+    return shuffled[n // 2], ordered[n // 3], backward[n // 4], partial[n // 5], by_digit[n // 6]
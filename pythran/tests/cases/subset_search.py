@@ -0,0 +1,15 @@
+#pythran export subset_search(int list, int, int)
+#runas subset_search(range(20), 4, 30)
+#bench subset_search(range(60), 5, 150)
+
+# brute-force search over 5 million combinations, none of them escaping the
+# loop body but the best one
+from itertools import combinations
+
+def subset_search(weights, r, target):
+    best, best_gap = [], target
+    for c in combinations(weights, r):
+        gap = abs(sum(c) - target)
+        if gap < best_gap:
+            best, best_gap = c, gap
+    return list(best), best_gap
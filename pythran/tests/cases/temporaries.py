@@ -0,0 +1,15 @@
+#pythran export temporaries(float[], int)
+#runas import numpy ; a = numpy.arange(1000.); temporaries(a, 10)
+#bench import numpy ; a = numpy.arange(100000.); temporaries(a, 2000)
+# stresses ndarray allocation: every iteration materializes new arrays,
+# compile with -DPYTHRAN_ALLOCATOR=... -DPYTHRAN_ALLOCATOR_STATS to compare
+# the allocation backends
+import numpy as np
+
+def temporaries(a, n):
+    s = 0.
+    for i in range(n):
+        b = a * i
+        c = np.sqrt(b + 1.)
+        s += np.sum(c - b) + c[0]
+    return s
@@ -0,0 +1,10 @@
+#pythran export transpose_add(float[][], float[][], float[][][])
+#runas import numpy ; a = numpy.arange(60.).reshape(6, 10); b = numpy.arange(60.).reshape(10, 6); c = numpy.arange(120.).reshape(2, 6, 10); transpose_add(a, b, c)
+#bench import numpy ; a = numpy.arange(4000. * 3000).reshape(4000, 3000); b = numpy.arange(4000. * 3000).reshape(3000, 4000); c = numpy.arange(1000000.).reshape(100, 100, 100); transpose_add(a, b, c)
+# transposed operands are read tile by tile
+import numpy as np
+
+def transpose_add(a, b, c):
+    d = a.T + b
+    d += 2. * a.T
+    return d.sum() + np.transpose(c, (2, 0, 1))[1].sum()
@@ -0,0 +1,9 @@
+#pythran export unique_counts(int[])
+#runas import numpy ; a = numpy.arange(10000) * 7919 % 1013 ; unique_counts(a)
+#bench import numpy ; a = numpy.random.randint(0, 1000000, 10000000) ; unique_counts(a)
+# numpy.unique on a large integer array, with all the optional outputs
+import numpy as np
+
+def unique_counts(a):
+    u, index, inverse, counts = np.unique(a, True, True, True)
+    return u[np.argmax(counts)], np.sum(index), np.sum(inverse)
@@ -0,0 +1,53 @@
+"""
+Measures the cost of calling a pythranized function, depending on the number
+of signatures it is exported with.
+
+The called signature is always the last one exported, which is the worst
+case for a dispatcher that checks each signature in turn. Run with::
+
+    python pythran/tests/dispatch_overhead.py
+"""
+
+from imp import load_dynamic
+import os
+import timeit
+
+import numpy
+
+from pythran import compile_pythrancode
+
+SIGNATURES = ['bool', 'int list', 'float list', 'str',
+              'int8[]', 'uint8[]', 'int16[]', 'uint16[]',
+              'int32[]', 'uint32[]', 'int64[]', 'uint64[]',
+              'float32[]', 'complex64[]', 'complex128[]']
+
+CODE = '''
+{exports}
+def dispatch_overhead(x):
+    return 0
+'''
+
+
+def call_overhead(nsignatures, number=100000, repeat=5):
+    """ Time per call, in nanoseconds, of a function exported with
+    ``nsignatures`` signatures, called with the last one. """
+    signatures = SIGNATURES[:nsignatures - 1] + ['float64[]']
+    exports = '\n'.join('#pythran export dispatch_overhead({})'.format(s)
+                        for s in signatures)
+    modname = 'dispatch_overhead{}'.format(nsignatures)
+    module_path = compile_pythrancode(modname,
+                                      CODE.format(exports=exports))
+    try:
+        function = load_dynamic(modname, module_path).dispatch_overhead
+        arg = numpy.ones(10)
+        timing = min(timeit.repeat(lambda: function(arg),
+                                   number=number, repeat=repeat))
+        return timing / number * 1e9
+    finally:
+        os.remove(module_path)
+
+
+if __name__ == '__main__':
+    for nsignatures in (1, 2, 4, 8, 16):
+        print('{:>2} signatures: {:.0f}ns per call'.format(
+            nsignatures, call_overhead(nsignatures)))
@@ -0,0 +1,8 @@
+def omp_parallel_random():
+    from numpy.random import random
+    LOOPCOUNT = 10000
+    out = [0.] * LOOPCOUNT
+    "omp parallel for"
+    for i in xrange(LOOPCOUNT):
+        out[i] = random()
+    return all(0 <= x < 1 for x in out) and len(set(out)) == LOOPCOUNT
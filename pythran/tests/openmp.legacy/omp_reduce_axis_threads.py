@@ -0,0 +1,18 @@
+import omp
+from numpy import arange, sin
+
+
+def omp_reduce_axis_threads():
+    a = sin(arange(200000.)).reshape(20000, 10) * 1000
+    b = sin(arange(60000.)).reshape(3000, 4, 5)
+    nthreads = omp.get_max_threads()
+
+    omp.set_num_threads(1)
+    sequential = a.sum(axis=0), a.max(axis=0), b.sum(axis=0)
+    omp.set_num_threads(4)
+    parallel = a.sum(axis=0), a.max(axis=0), b.sum(axis=0)
+    omp.set_num_threads(nthreads)
+
+    return ((sequential[0] == parallel[0]).all() and
+            (sequential[1] == parallel[1]).all() and
+            (sequential[2] == parallel[2]).all())
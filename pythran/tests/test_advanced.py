@@ -63,6 +63,9 @@ def bool_op_casting():
     def test_parallel_enumerate(self):
         self.run_test('def parallel_enumerate(l):\n k = [0]*(len(l) + 1)\n "omp parallel for"\n for i,j in enumerate(l):\n  k[i+1] = j\n return k', range(1000), parallel_enumerate=[[int]])
 
+    def test_parallel_combinations(self):
+        self.run_test('def parallel_combinations(n):\n from itertools import combinations, product\n s = 0\n "omp parallel for reduction(+:s)"\n for c in combinations(range(n), 4):\n  s += c[0] * c[3] - c[1] * c[2]\n t = 0\n "omp parallel for reduction(+:t)"\n for i, j in product(range(n), range(n)):\n  t += i * j % 7\n return s, t', 30, parallel_combinations=[int])
+
     def test_ultra_nested_functions(self):
         code = '''
 def ultra_nested_function(n):
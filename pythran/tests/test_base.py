@@ -471,6 +471,12 @@ def nested_def(a):
     def test_sorted(self):
         self.run_test("def sorted_(l): return [x for x in sorted(l)]", [1,2,3], sorted_=[[int]])
 
+    def test_sorted_stable(self):
+        self.run_test("def sorted_stable(l): return sorted(l, key=lambda x: x[1]), sorted(l, key=lambda x: x[1], reverse=True)", [('a', 2), ('b', 1), ('c', 2), ('d', 0), ('e', 1)], sorted_stable=[[(str, int)]])
+
+    def test_sorted_runs(self):
+        self.run_test("def sorted_runs(n): return sorted(range(n) + range(n, 0, -1) + [i % 7 for i in range(n)], reverse=True)", 10000, sorted_runs=[int])
+
     def test_str(self):
         self.run_test("def str_(l): return str(l)", [1,2,3], str_=[[int]])
 
@@ -586,6 +592,50 @@ def yielder():
     return [i*i for i in f]"""
         self.run_test(code, yielder=[])
 
+    def test_yielder_next_builtin(self):
+        code="""
+def iyielder_next(i):
+    for k in xrange(i):
+        yield k
+
+def yielder_next_builtin(n):
+    f=iyielder_next(n)
+    a=next(f)
+    b=next(f)
+    return a, b, [i*i for i in f]"""
+        self.run_test(code, 5, yielder_next_builtin=[int])
+
+    def test_yielder_exhausted(self):
+        code="""
+def iyielder_exhausted(i):
+    for k in xrange(i):
+        yield k
+
+def yielder_exhausted(n):
+    f=iyielder_exhausted(n)
+    l=[f.next() for _ in xrange(n)]
+    for k in xrange(2):
+        try:
+            l.append(f.next())
+        except StopIteration:
+            l.append(-1)
+    return l + [i for i in f]"""
+        self.run_test(code, 3, yielder_exhausted=[int])
+
+    def test_yielder_short_lived(self):
+        code="""
+def iyielder_short(i):
+    yield i
+    yield 2 * i
+
+def yielder_short_lived(n):
+    s = 0
+    for i in xrange(n):
+        for v in iyielder_short(i):
+            s += v
+    return s"""
+        self.run_test(code, 100000, yielder_short_lived=[int])
+
     def test_yield_with_default_param(self):
         code="""
 def foo(a=1000):
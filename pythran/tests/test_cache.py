@@ -0,0 +1,67 @@
+import unittest
+import os
+import shutil
+import tempfile
+
+import pythran
+from pythran import cache
+from pythran.config import cfg
+
+
+class TestCache(unittest.TestCase):
+
+    code = '''
+#pythran export cached(int list)
+def cached(l):
+    return sum(l)
+'''
+
+    def setUp(self):
+        self.tmpdir = tempfile.mkdtemp()
+        self.saved = dict(cfg.items('cache'))
+        cfg.set('cache', 'enabled', 'True')
+        cfg.set('cache', 'dir', os.path.join(self.tmpdir, 'cache'))
+
+    def tearDown(self):
+        for option, value in self.saved.items():
+            cfg.set('cache', option, value)
+        shutil.rmtree(self.tmpdir)
+
+    def compile(self, code, name):
+        output = os.path.join(self.tmpdir, name + cache.extension_suffix())
+        return pythran.compile_pythrancode('cached', code,
+                                           output_file=output)
+
+    def test_hit(self):
+        first = self.compile(self.code, 'first')
+        self.assertEqual(cache.stats()['miss'], 1)
+        second = self.compile(self.code, 'second')
+        self.assertEqual(cache.stats()['hit'], 1)
+        with open(first, 'rb') as f, open(second, 'rb') as s:
+            self.assertEqual(f.read(), s.read())
+
+    def test_miss_on_change(self):
+        self.compile(self.code, 'first')
+        self.compile(self.code.replace('int list', 'float list'), 'second')
+        stats = cache.stats()
+        self.assertEqual((stats['hit'], stats['miss']), (0, 2))
+
+    def test_clear(self):
+        self.compile(self.code, 'first')
+        cache.clear()
+        self.assertEqual(cache.stats()['miss'], 0)
+
+    def test_miss_on_pythran_change(self):
+        self.compile(self.code, 'first')
+        saved = cache._pythran_hash[:]
+        try:
+            cache._pythran_hash[:] = ['edited pass']
+            self.compile(self.code, 'second')
+        finally:
+            cache._pythran_hash[:] = saved
+        stats = cache.stats()
+        self.assertEqual((stats['hit'], stats['miss']), (0, 2))
+
+    def test_pch_skipped_with_include(self):
+        extension = {'extra_compile_args': ['-O2', '-include', 'config.h']}
+        self.assertEqual(cache.precompiled_header('', extension), [])
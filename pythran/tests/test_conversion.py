@@ -95,11 +95,29 @@ def dict_of_complex64_and_complex_128(l):
         self.run_test(code, np.array(np.arange((128), dtype=np.uint8).reshape((16,8)))[:,1::3],
                       ndarray_with_multi_strides=[np.array([[np.uint8]])[::-1]])
 
-    def test_ndarray_unsupported_reshaped_array_with_stride(self):
-        code = 'def ndarray_unsupported_reshaped_array_with_stride(a): return a'
-        with self.assertRaises(BaseException):
-            self.run_test(code, np.arange((128), dtype=np.uint8).reshape((16,8))[1::3,2::2],
-                          ndarray_unsupported_reshaped_array_with_stride=[np.array([[np.uint8]])[::-1]])
+    def test_ndarray_reshaped_array_with_stride(self):
+        code = 'def ndarray_reshaped_array_with_stride(a): return a'
+        self.run_test(code, np.arange((128), dtype=np.uint8).reshape((16,8))[1::3,2::2],
+                      ndarray_reshaped_array_with_stride=[np.array([[np.uint8]])[::-1]])
+
+    def test_ndarray_with_negative_strides(self):
+        code = 'def ndarray_with_negative_strides(a): return a[1:, ::2] * 2, a.sum()'
+        self.run_test(code, np.arange(60.).reshape((6,10))[::-2, ::-3],
+                      ndarray_with_negative_strides=[np.array([[float]])[::-1]])
+
+    def test_ndarray_with_swapped_axes(self):
+        code = 'def ndarray_with_swapped_axes(a): return a[0], a[:,1:,2] + 1'
+        self.run_test(code, np.arange(60).reshape((3,4,5)).swapaxes(0, 2),
+                      ndarray_with_swapped_axes=[np.array([[[int]]])[::-1]])
+
+    def test_ndarray_strided_update(self):
+        code = '''
+def ndarray_strided_update(a):
+    a[1:] += a[:-1]
+    a *= 2
+    return a'''
+        self.run_test(code, np.arange(30).reshape((5,6))[::2, 1::2],
+                      ndarray_strided_update=[np.array([[int]])[::-1]])
 
     def test_transposed_arg0(self):
         self.run_test("def np_transposed_arg0(a): return a", np.arange(9).reshape(3,3).T, np_transposed_arg0=[np.array([[int]]).T])
@@ -107,6 +125,11 @@ def dict_of_complex64_and_complex_128(l):
     def test_transposed_arg1(self):
         self.run_test("def np_transposed_arg1(a): return a", np.arange(12).reshape(3,4).T, np_transposed_arg1=[np.array([[int]]).T])
 
+    def test_fortran_ordered_3d_arg(self):
+        self.run_test("def np_fortran_ordered_3d_arg(a): return a[1], a.sum(axis=0)",
+                      np.asfortranarray(np.arange(24.).reshape(2,3,4)),
+                      np_fortran_ordered_3d_arg=[np.array([[[float]]])])
+
     def test_transposed_arg2(self):
         self.run_test("def np_transposed_arg2(a): return a", np.arange(12, dtype=complex).reshape(3,4).T, np_transposed_arg2=[np.array([[complex]]).T])
 
@@ -114,3 +114,12 @@ def dict_copy(a):
 
     def test_dict_setdefault_combiner(self):
         return self.run_test("def dict_setdefault_combiner():\n a=dict()\n a.setdefault(1,'e')\n return a", dict_setdefault_combiner=[])
+
+    def test_dict_grow_and_pop(self):
+        return self.run_test("def dict_grow_and_pop(n):\n a={}\n for i in range(n): a[i*7919] = i\n for i in range(0, n, 3): a.pop(i*7919)\n for i in range(n, 2*n): a[i] = -i\n return sorted(a.items())", 1000, dict_grow_and_pop=[int])
+
+    def test_dict_str_lookup(self):
+        return self.run_test("def dict_str_lookup(n):\n a={i: str(i) for i in range(10)}\n s=''\n for i in range(n): s = a[i % 10] + s[:3]\n return s, len(a)", 1000, dict_str_lookup=[int])
+
+    def test_dict_aliased_item(self):
+        return self.run_test("def dict_aliased_item(n):\n a={0:[0]}\n for i in range(1, n): a[i] = a[i - 1]\n return a[n - 1]", 100, dict_aliased_item=[int])
@@ -227,3 +227,34 @@ def _rvalue_close(filename):
     def test_xreadlines(self):
         self.tempfile()
         self.run_test("""def _xreadlines(filename):\n f=file(filename)\n return [l for l in f.xreadlines()]""", self.filename, _xreadlines=[str])
+
+    def test_iter_no_trailing_newline(self):
+        filename = mkstemp()[1]
+        with open(filename, "w") as f:
+            f.write("azerty\nqwerty")
+        self.run_test("def iter_no_trailing_newline(filename):\n return [line for line in file(filename)]", filename, iter_no_trailing_newline=[str])
+
+    def test_iter_empty_file(self):
+        filename = mkstemp()[1]
+        self.run_test("def iter_empty_file(filename):\n return [line for line in file(filename)]", filename, iter_empty_file=[str])
+
+    def test_seek_tell_read(self):
+        self.tempfile()
+        self.run_test("def seek_tell_read(filename):\n f = file(filename)\n f.seek(3)\n a = f.readline()\n b = f.tell()\n f.seek(-4, 2)\n return a, b, f.read(), f.tell()", self.filename, seek_tell_read=[str])
+
+    def test_seek_past_end(self):
+        self.tempfile()
+        self.run_test("def seek_past_end(filename):\n f = file(filename)\n f.seek(100)\n a = f.read()\n b = f.readline()\n return a, b, f.tell(), [l for l in f]", self.filename, seek_past_end=[str])
+
+    def test_long_lines(self):
+        filename = mkstemp()[1]
+        with open(filename, "w") as f:
+            f.write("".join("%d%s\n" % (i, "x" * (i * 997 % 5000)) for i in range(50)))
+        self.run_test("def long_lines(filename):\n f = file(filename)\n a = f.readline()\n b = f.readline(1500)\n c = f.read(3000)\n return a, b, c, f.readlines(), [len(l) for l in file(filename)]", filename, long_lines=[str])
+
+
+class TestFileMmap(TestFile):
+
+    """ Same tests, with read-only files mapped in memory. """
+
+    PYTHRAN_CXX_FLAGS = TestFile.PYTHRAN_CXX_FLAGS + ['-DPYTHRAN_FILE_MMAP']
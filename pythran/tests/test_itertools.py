@@ -193,6 +193,41 @@ def ifilter_with_nested_lambdas(N):
                       [0,1,2,3,4,5], 2,
                       permutations_=[[int],int])
 
+    def test_combinations_escape(self):
+        self.run_test("def combinations_escape(l0,a):\n"
+                      "  from itertools import combinations\n"
+                      "  kept = []\n"
+                      "  for c in combinations(l0, a):\n"
+                      "    if c[0] + c[-1] > 5: kept.append(c)\n"
+                      "  return kept, [c for c in combinations(l0, a)]",
+                      range(7), 3,
+                      combinations_escape=[[int],int])
+
+    def test_combinations_mutate(self):
+        self.run_test("def combinations_mutate(l0,a):\n"
+                      "  from itertools import combinations, permutations\n"
+                      "  out = []\n"
+                      "  for c in combinations(l0, a):\n"
+                      "    c += c\n"
+                      "    out.append(c)\n"
+                      "  s = 0\n"
+                      "  for p in permutations(l0, a):\n"
+                      "    p += p\n"
+                      "    s += sum(p) * len(p)\n"
+                      "  return out, s",
+                      range(5), 2,
+                      combinations_mutate=[[int],int])
+
+    def test_permutations_short_prefix(self):
+        self.run_test("def permutations_short_prefix(n):"
+                      "  from itertools import permutations;"
+                      "  return sum(p[0] * p[1] - p[2] for p in permutations(range(n), 3)), list(permutations(range(5), 2))",
+                      14,
+                      permutations_short_prefix=[int])
+
+    def test_product_empty(self):
+        self.run_test("def product_empty(l0,l1): from itertools import product; return list(product(l0, l1)), list(product(l1, l0))", [1, 2], [], product_empty=[[int], [int]])
+
     def test_imap_over_array(self):
         self.run_test("def imap_over_array(l):"
                       "  from itertools import imap ;"
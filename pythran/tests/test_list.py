@@ -29,6 +29,21 @@ class TestList(TestEnv):
     def test_sort_(self):
         self.run_test("def sort_():\n b=[1,3,5,4,2]\n b.sort()\n return b", sort_=[])
 
+    def test_sort_key(self):
+        self.run_test("def sort_key(b):\n b.sort(key=lambda x: x[0])\n return b", [(2, 'a'), (1, 'b'), (2, 'c'), (1, 'd'), (0, 'e')], sort_key=[[(int, str)]])
+
+    def test_sort_reverse(self):
+        self.run_test("def sort_reverse(b):\n b.sort(key=lambda x: x % 4, reverse=True)\n return b", range(20), sort_reverse=[[int]])
+
+    def test_sort_cmp(self):
+        self.run_test("def sort_cmp(b):\n b.sort(lambda x, y: y - x)\n return b", [3, 1, 4, 1, 5, 9, 2, 6], sort_cmp=[[int]])
+
+    def test_sort_key_raises(self):
+        self.run_test("def key(s):\n if not s: raise ValueError(s)\n return len(s)\ndef sort_key_raises(b):\n try: b.sort(key=key)\n except ValueError: pass\n return b, [s + '!' for s in b]", ['abc', 'de', 'f', '', 'ghij'], sort_key_raises=[[str]])
+
+    def test_sort_large(self):
+        self.run_test("def sort_large(n):\n b=[(i * 7919) % 1009 for i in range(n)] + range(n) + range(n, 0, -1)\n b.sort()\n return b", 100000, sort_large=[int])
+
     def test_insert_(self):
         self.run_test("def insert_(a,b):\n c=[1,3,5,4,2]\n c.insert(a,b)\n return c",2,5, insert_=[int,int])
 
@@ -69,3 +84,18 @@ class TestList(TestEnv):
         self.run_test("def assigned_slice(l): l[0]=l[2][1:3] ; return l",
                       [[1,2,3],[1,4,1],[1,4,8,9]], assigned_slice=[[[int]]])
 
+    def test_list_slice_negative_index(self):
+        self.run_test("def list_slice_negative_index(l): return l[1:][-1], l[::2][-2]",
+                      [1,2,3,4,5,6], list_slice_negative_index=[[int]])
+
+    def test_list_positive_index(self):
+        self.run_test("def list_positive_index(l): return [l[i + 1] - l[i] for i in range(len(l) - 1)]",
+                      [1,2,4,8,16], list_positive_index=[[int]])
+
+    def test_list_comp_scalars(self):
+        self.run_test("def list_comp_scalars(l): return [x * x + 1. for x in l]",
+                      [x * .25 for x in range(5000)], list_comp_scalars=[[float]])
+
+    def test_list_comp_closure(self):
+        self.run_test("def list_comp_closure(l, a): return [a * x - 1 for x in l], [x % 3 == 0 for x in range(len(l))]",
+                      list(range(3000)), 7, list_comp_closure=[[int], int])
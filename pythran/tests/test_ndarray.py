@@ -617,3 +617,56 @@ def assign_ndarray(t):
         self.run_test("def ndarray_str_dtype1(a): return str(a.dtype)",
                       numpy.arange(16.),
                       ndarray_str_dtype1=[numpy.array([float])])
+
+    def test_ndarray_assign_expr2d(self):
+        self.run_test("""
+                      def ndarray_assign_expr2d(a, b):
+                        c = a.copy()
+                        c[:] = a * b + 1.
+                        c += b
+                        return c""",
+                      numpy.arange(35.).reshape(5, 7),
+                      numpy.arange(35.).reshape(5, 7) ** 2,
+                      ndarray_assign_expr2d=[numpy.array([[float]]),
+                                             numpy.array([[float]])])
+
+    def test_ndarray_assign_expr3d(self):
+        self.run_test("""
+                      def ndarray_assign_expr3d(a, b):
+                        c = a.copy()
+                        c[1:] = a[:-1] + b
+                        c[0] += b
+                        return c""",
+                      numpy.arange(60.).reshape(3, 4, 5),
+                      numpy.arange(5.),
+                      ndarray_assign_expr3d=[numpy.array([[[float]]]),
+                                             numpy.array([float])])
+
+    def test_ndarray_positive_index_stencil(self):
+        self.run_test("""
+                      def ndarray_positive_index_stencil(a):
+                        b = numpy.zeros_like(a)
+                        for i in range(1, len(a) - 1):
+                          b[i] = a[i - 1] + a[i + 1] - 2 * a[i]
+                        return b""",
+                      numpy.arange(10.) ** 2,
+                      ndarray_positive_index_stencil=[numpy.array([float])])
+
+    def test_ndarray_positive_tuple_index(self):
+        self.run_test("""
+                      def ndarray_positive_tuple_index(a):
+                        b = numpy.zeros_like(a)
+                        for i in range(1, a.shape[0]):
+                          for j in range(a.shape[1] - 1):
+                            b[i, j] = a[i - 1, j + 1] + a[i][j] + a[i, -1]
+                        return b""",
+                      numpy.arange(35.).reshape(5, 7),
+                      ndarray_positive_tuple_index=[numpy.array([[float]])])
+
+    def test_ndarray_negative_tuple_index(self):
+        self.run_test("""
+                      def ndarray_negative_tuple_index(a):
+                        return (a[-1, 0, -2], a[1, -1], a[-1][-2, -3],
+                                a[1:][-1, -1, -1], a.T[0, -1, 1])""",
+                      numpy.arange(60).reshape(3, 4, 5),
+                      ndarray_negative_tuple_index=[numpy.array([[[int]]])])
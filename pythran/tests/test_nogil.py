@@ -0,0 +1,67 @@
+from imp import load_dynamic
+from test_env import TestEnv
+from pythran import cache
+from pythran.spec import NoGILSignature
+import numpy
+import os
+import pythran
+import shutil
+import tempfile
+import threading
+
+
+class TestNoGIL(TestEnv):
+
+    def test_nogil_ndarray(self):
+        self.run_test("def nogil_ndarray(a):\n"
+                      " from numpy import cumsum\n"
+                      " return a.sum(), [x * 2 for x in a], cumsum(a)",
+                      numpy.arange(10.),
+                      nogil_ndarray=NoGILSignature([numpy.array([float])]))
+
+    def test_nogil_exception(self):
+        self.run_test("def nogil_exception(a):\n"
+                      " if a.sum() > 10: raise ValueError('too large')\n"
+                      " return a",
+                      numpy.arange(10),
+                      nogil_exception=NoGILSignature([numpy.array([int])]),
+                      check_exception=True)
+
+    def test_nogil_releases_gil(self):
+        # flag[1] is set when the kernel starts, the helper thread can only
+        # see it and answer through flag[0] while the kernel runs if the GIL
+        # was released
+        code = '''
+#pythran export nogil wait_for_flag(int64[], int)
+def wait_for_flag(flag, n):
+    flag[1] = 1
+    for i in range(n):
+        if flag[0]:
+            return True
+    return False
+'''
+        tmpdir = tempfile.mkdtemp()
+        try:
+            output = os.path.join(tmpdir, 'nogil_releases_gil' +
+                                  cache.extension_suffix())
+            module_path = pythran.compile_pythrancode(
+                'nogil_releases_gil', code, output_file=output,
+                extra_compile_args=self.PYTHRAN_CXX_FLAGS)
+            module = load_dynamic('nogil_releases_gil', module_path)
+
+            flag = numpy.zeros(2, dtype=numpy.int64)
+
+            def answer():
+                while not flag[1]:
+                    pass
+                flag[0] = 1
+
+            helper = threading.Thread(target=answer)
+            helper.start()
+            try:
+                self.assertTrue(module.wait_for_flag(flag, 10 ** 9))
+            finally:
+                flag[1] = 1
+                helper.join()
+        finally:
+            shutil.rmtree(tmpdir)
@@ -1,4 +1,5 @@
 import unittest
+from tempfile import mkstemp
 from test_env import TestEnv
 import numpy
 import sys
@@ -37,6 +38,16 @@ class TestNumpyFunc0(TestEnv):
                       numpy.arange(120).reshape((3,5,4,2)),
                       numpy_extended_sum5=[numpy.array([numpy.array([numpy.array([numpy.array([int])])])])])
 
+    def test_extended_sum6(self):
+        self.run_test("def numpy_extended_sum6(a): import numpy ; return numpy.sum(a, 1), numpy.sum(a, 0)",
+                      numpy.arange(120.).reshape((3,5,4,2)),
+                      numpy_extended_sum6=[numpy.array([numpy.array([numpy.array([numpy.array([float])])])])])
+
+    def test_large_sum(self):
+        self.run_test("def numpy_large_sum(a): import numpy ; return numpy.sum(a), numpy.sum(a.reshape(1000, 100), 0)",
+                      numpy.arange(100000.) / 7,
+                      numpy_large_sum=[numpy.array([float])])
+
     def test_numpy_shape_as_function(self):
          self.run_test("def numpy_shape_as_function(a): import numpy ; return numpy.shape(a)",
                        numpy.ones(3, numpy.int16),
@@ -224,6 +235,24 @@ def np_rosen_der(x):
     def test_median1(self):
         self.run_test("def np_median1(a): from numpy import median ; return median(a)", numpy.array([1, 2, 3, 4,5]), np_median1=[numpy.array([int])])
 
+    def test_median2(self):
+        self.run_test("def np_median2(a): from numpy import median ; return median(a, 1)", numpy.arange(3*4*5.).reshape(3,4,5) % 7, np_median2=[numpy.array([[[float]]])])
+
+    def test_median3(self):
+        self.run_test("def np_median3(a): from numpy import median ; return median(a, 0), median(a, -1)", (numpy.arange(24*1001) * 7919 % 1013).reshape(24, 1001), np_median3=[numpy.array([[int]])])
+
+    def test_percentile0(self):
+        self.run_test("def np_percentile0(a): from numpy import percentile ; return percentile(a, 37.5)", numpy.arange(1001.) % 17, np_percentile0=[numpy.array([float])])
+
+    def test_percentile1(self):
+        self.run_test("def np_percentile1(a): from numpy import percentile ; return percentile(a, 90, 1)", numpy.arange(12*10).reshape(12, 10) * 7 % 11, np_percentile1=[numpy.array([[int]])])
+
+    def test_percentile2(self):
+        self.run_test("def np_percentile2(a): from numpy import percentile ; return percentile(a, [75, 25, 50])", numpy.arange(12*10.).reshape(12, 10) % 13, np_percentile2=[numpy.array([[float]])])
+
+    def test_quantile0(self):
+        self.run_test("def np_quantile0(a): from numpy import quantile ; return quantile(a, .3), quantile(a, .7, 0)", numpy.arange(12*10.).reshape(12, 10) % 13, np_quantile0=[numpy.array([[float]])])
+
     def test_mean0(self):
         self.run_test("def np_mean0(a): from numpy import mean ; return mean(a)", numpy.array([[1, 2], [3, 4]]), np_mean0=[numpy.array([[int]])])
 
@@ -362,6 +391,33 @@ def np_rosen_der(x):
     def test_fromstring3(self):
         self.run_test("def np_fromstring3(a): from numpy import fromstring, uint32 ; return fromstring(a, uint32,2, ',')", '1,2, 3, 4', np_fromstring3=[str])
 
+    def test_fromstring4(self):
+        self.run_test("def np_fromstring4(a): from numpy import fromstring, float64 ; return fromstring(a, float64, -1, ' , ')", '1.5, -2e3 ,0.1 , 1e-300,12345678901234567890', np_fromstring4=[str])
+
+    def test_fromstring5(self):
+        self.run_test("def np_fromstring5(a): from numpy import fromstring, int64 ; return fromstring(a, int64, -1, ' ')", ' 1\t-2\n 3  4 ', np_fromstring5=[str])
+
+    def test_fromstring6(self):
+        self.run_test("def np_fromstring6(a): from numpy import fromstring, int64 ; return fromstring(a, int64, -1, ' ')", '99999999999999999999 -99999999999999999999 9223372036854775807', np_fromstring6=[str])
+
+    def loadtxt_file(self, content):
+        filename = mkstemp()[1]
+        with open(filename, 'w') as f:
+            f.write(content)
+        return filename
+
+    def test_loadtxt0(self):
+        filename = self.loadtxt_file("# x y z\n1 2 3\n4.5 -5 6e2 # comment\n\n7 8 9\n")
+        self.run_test("def np_loadtxt0(f): from numpy import loadtxt ; return loadtxt(f)", filename, np_loadtxt0=[str])
+
+    def test_loadtxt1(self):
+        filename = self.loadtxt_file("a,b,c\n1,2,3\n4,5,6\n")
+        self.run_test("def np_loadtxt1(f): from numpy import loadtxt, int64 ; return loadtxt(f, int64, '#', ',', None, 1, (2, 0))", filename, np_loadtxt1=[str])
+
+    def test_loadtxt2(self):
+        filename = self.loadtxt_file("1;2;3\n4;5;6\n")
+        self.run_test("def np_loadtxt2(f): from numpy import loadtxt, float64 ; return loadtxt(f, float64, '#', ';', None, 0, 1)", filename, np_loadtxt2=[str])
+
     def test_outer0(self):
         self.run_test("def np_outer0(x): from numpy import outer ; return outer(x, x+2)", numpy.arange(6).reshape(2,3), np_outer0=[numpy.array([[int]])])
 
@@ -530,6 +586,12 @@ def np_rosen_der(x):
     def test_sort4(self):
         self.run_test("def np_sort4(a): from numpy import sort ; return sort(a, 1)", numpy.arange(2*3*4, 0, -1).reshape(2,3,4), np_sort4=[numpy.array([[[int]]])])
 
+    def test_sort5(self):
+        self.run_test("def np_sort5(a): from numpy import sort ; return sort(a, 0), sort(a)", numpy.sin(numpy.arange(3000.)).reshape(1500, 2), np_sort5=[numpy.array([[float]])])
+
+    def test_sort6(self):
+        self.run_test("def np_sort6(a): from numpy import sort ; return sort(a, 0)", (numpy.arange(40*30*20) * 7919 % 1013).reshape(40, 30, 20) - 500, np_sort6=[numpy.array([[[int]]])])
+
     def test_sort_complex0(self):
         self.run_test("def np_sort_complex0(a): from numpy import sort_complex ; return sort_complex(a)", numpy.array([[1,6],[7,5]]), np_sort_complex0=[numpy.array([[int]])])
 
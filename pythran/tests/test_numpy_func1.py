@@ -170,6 +170,21 @@ class TestNumpyFunc1(TestEnv):
     def test_transpose2_(self):
         self.run_test("def np_transpose2_(a): return a.transpose((2,0,1))", numpy.arange(24).reshape(2,3,4), np_transpose2_=[numpy.array([[[int]]])])
 
+    def test_transpose3_(self):
+        self.run_test("def np_transpose3_(a): return a.transpose((1,3,0,2))", numpy.arange(3*5*4*7, dtype=numpy.float32).reshape(3,5,4,7), np_transpose3_=[numpy.array([[[[numpy.float32]]]])])
+
+    def test_transpose_blocked(self):
+        self.run_test("def np_transpose_blocked(a): import numpy as np ; return np.transpose(a)", numpy.arange(70*45.).reshape(70,45), np_transpose_blocked=[numpy.array([[float]])])
+
+    def test_transpose_blocked_int32(self):
+        self.run_test("def np_transpose_blocked_int32(a): return a.T.copy()", numpy.arange(33*65, dtype=numpy.int32).reshape(33,65), np_transpose_blocked_int32=[numpy.array([[numpy.int32]])])
+
+    def test_transpose_assign(self):
+        self.run_test("def np_transpose_assign(a, c): import numpy ; b = numpy.ones((a.shape[1], a.shape[0])) ; b[:] = a.T + c ; b += 2 * a.T ; return b", numpy.arange(40*37.).reshape(40,37), numpy.arange(37*40.).reshape(37,40), np_transpose_assign=[numpy.array([[float]]), numpy.array([[float]])])
+
+    def test_transpose_inplace(self):
+        self.run_test("def np_transpose_inplace(a): a += a.T ; return a", numpy.arange(35*35.).reshape(35,35), np_transpose_inplace=[numpy.array([[float]])])
+
     def test_alen0(self):
         self.run_test("def np_alen0(a): from numpy import alen ; return alen(a)", numpy.ones((5,6)), np_alen0=[numpy.array([[float]])])
 
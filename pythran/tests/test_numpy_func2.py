@@ -375,6 +375,12 @@ def test_copy0(x):
     def test_argsort0(self):
         self.run_test("def np_argsort0(x): from numpy import argsort ; return argsort(x)", numpy.array([3, 1, 2]), np_argsort0=[numpy.array([int])])
 
+    def test_argsort2(self):
+        self.run_test("def np_argsort2(x): from numpy import argsort ; return argsort(x, 0)", numpy.array([[3, 1, 2], [1 , 2, 3]]), np_argsort2=[numpy.array([[int]])])
+
+    def test_argsort3(self):
+        self.run_test("def np_argsort3(x): from numpy import argsort ; return argsort(x)", numpy.cos(numpy.arange(5000.)), np_argsort3=[numpy.array([float])])
+
     def test_argsort1(self):
         self.run_test("def np_argsort1(x): from numpy import argsort ; return argsort(x)", numpy.array([[3, 1, 2], [1 , 2, 3]]), np_argsort1=[numpy.array([[int]])])
 
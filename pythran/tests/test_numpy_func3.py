@@ -15,6 +15,7 @@ class TestNumpyFunc3(TestEnv):
 
     Tested functions are:
     - numpy.dot
+    - numpy.matmul
     - numpy.digitize
     - numpy.diff
     - numpy.trace
@@ -165,6 +166,80 @@ class TestNumpyFunc3(TestEnv):
                       numpy.arange(6).reshape(3, 2),
                       np_dot16=[numpy.array([int]), numpy.array([[int]])])
 
+    def test_dot17(self):
+        """ Check for dot with "no blas type" on transposed operands. """
+        self.run_test("""
+        def np_dot17(x, y):
+            from numpy import dot
+            return dot(x.T, y.T)""",
+                      numpy.arange(12).reshape(3, 4),
+                      numpy.arange(15).reshape(5, 3),
+                      np_dot17=[numpy.array([[int]]), numpy.array([[int]])])
+
+    def test_dot18(self):
+        """ Check for dot on strided slices. """
+        self.run_test("""
+        def np_dot18(x, y):
+            from numpy import dot
+            return dot(x[::2, 1::3], y[1:, ::-1]), dot(x[::-2, 1::3] * 2, y[1:, 2])""",
+                      numpy.arange(70.).reshape(7, 10),
+                      numpy.arange(20.).reshape(4, 5),
+                      np_dot18=[numpy.array([[float]]), numpy.array([[float]])])
+
+    def test_dot19(self):
+        """ Check for dot with mixed dtypes and large operands. """
+        self.run_test("""
+        def np_dot19(x, y):
+            from numpy import dot
+            return dot(x, y)""",
+                      numpy.arange(200 * 300).reshape(200, 300) % 7,
+                      numpy.arange(300 * 70.).reshape(300, 70) % 5,
+                      np_dot19=[numpy.array([[int]]), numpy.array([[float]])])
+
+    def test_dot20(self):
+        """ Check for dot of a 3D array by a matrix and by a vector. """
+        self.run_test("""
+        def np_dot20(x, y, z):
+            from numpy import dot
+            return dot(x, y), dot(x, z), dot(x[:, ::2], y)""",
+                      numpy.arange(60).reshape(3, 4, 5),
+                      numpy.arange(10).reshape(5, 2),
+                      numpy.arange(5),
+                      np_dot20=[numpy.array([[[int]]]), numpy.array([[int]]),
+                                numpy.array([int])])
+
+    def test_matmul0(self):
+        """ Check for matmul on stacks of matrices. """
+        self.run_test("""
+        def np_matmul0(x, y):
+            from numpy import matmul
+            return matmul(x, y)""",
+                      numpy.arange(60).reshape(3, 4, 5),
+                      numpy.arange(30).reshape(3, 5, 2),
+                      np_matmul0=[numpy.array([[[int]]]), numpy.array([[[int]]])])
+
+    def test_matmul1(self):
+        """ Check for matmul broadcasting stacks of matrices. """
+        self.run_test("""
+        def np_matmul1(x, y):
+            from numpy import matmul
+            return matmul(x, y)""",
+                      numpy.arange(40.).reshape(2, 1, 4, 5),
+                      numpy.arange(90.).reshape(3, 5, 6),
+                      np_matmul1=[numpy.array([[[[float]]]]), numpy.array([[[float]]])])
+
+    def test_matmul2(self):
+        """ Check for matmul of stacks of matrices and vectors. """
+        self.run_test("""
+        def np_matmul2(x, y, z):
+            from numpy import matmul
+            return matmul(x, y), matmul(z, x), matmul(x[0], y)""",
+                      numpy.arange(60).reshape(3, 4, 5),
+                      numpy.arange(5),
+                      numpy.arange(4),
+                      np_matmul2=[numpy.array([[[int]]]), numpy.array([int]),
+                                  numpy.array([int])])
+
     def test_digitize0(self):
         self.run_test("def np_digitize0(x): from numpy import array, digitize ; bins = array([0.0, 1.0, 2.5, 4.0, 10.0]) ; return digitize(x, bins)", numpy.array([0.2, 6.4, 3.0, 1.6]), np_digitize0=[numpy.array([float])])
 
@@ -258,6 +333,15 @@ def np_trim_zeros2(x):
     def test_unique3(self):
         self.run_test("def np_unique3(x): from numpy import unique ; return unique(x, True, True)", numpy.array([1,1,2,2,2,1,5]), np_unique3=[numpy.array([int])])
 
+    def test_unique4(self):
+        self.run_test("def np_unique4(x): from numpy import unique ; return unique(x, True, True, True)", numpy.array([[3, 1, 3, 7], [1, 1, 9, 3]]), np_unique4=[numpy.array([[int]])])
+
+    def test_unique5(self):
+        self.run_test("def np_unique5(x): from numpy import unique ; return unique(x, True, True)", numpy.arange(5000) * 7919 % 1013, np_unique5=[numpy.array([int])])
+
+    def test_unique6(self):
+        self.run_test("def np_unique6(x): from numpy import unique ; return unique(x), unique(x, True, True, True)", numpy.array([numpy.nan, 2., numpy.nan, -1., 2., 0.]), np_unique6=[numpy.array([float])])
+
     def test_unwrap0(self):
         self.run_test("def np_unwrap0(x): from numpy import unwrap, pi ; x[:3] += 2*pi; return unwrap(x)", numpy.arange(6, dtype=float), np_unwrap0=[numpy.array([float])])
 
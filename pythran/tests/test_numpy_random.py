@@ -556,3 +556,18 @@ class TestNumpyRandom(TestEnv):
                 a = bytes(n)
                 assert(abs(mean(fromstring(a, uint8)) - 127.5) < .05)""",
                       10 ** 8, numpy_random_bytes1=[int])
+
+    ###########################################################################
+    # Tests for numpy.random.seed
+    ###########################################################################
+
+    def test_numpy_random_seed(self):
+        """ Check seeded numpy.random fills generate always the same values. """
+        self.run_test("""
+            def numpy_random_seed(n):
+                from numpy.random import seed, normal, random
+                seed(1)
+                a, b = normal(0, 1, n), random()
+                seed(1)
+                return (a == normal(0, 1, n)).all() and b == random()""",
+                      10 ** 5, numpy_random_seed=[int])
@@ -1,5 +1,6 @@
 from test_env import TestEnv
 import pythran
+import numpy
 
 class TestOptimization(TestEnv):
 
@@ -267,6 +268,39 @@ def foo():
     return __builtin__.None"""
         self.check_ast(init, ref, ["pythran.optimizations.ForwardSubstitution"])
 
+    def test_expression_fusion(self):
+        init = """
+def foo(a, b, c):
+    s = 0
+    #omp parallel for reduction(+:s)
+    for i in range(3):
+        t = a * b
+        t = t + c
+        s += t
+    return s"""
+        ref = """import itertools
+def foo(a, b, c):
+    s = 0
+    'omp parallel for reduction(+:s)'
+    for i in __builtin__.range(3):
+        s += ((a * b) + c)
+    return s"""
+        self.check_ast(init, ref, ["pythran.optimizations.ExpressionFusion"])
+
+    def test_expression_fusion_redefined(self):
+        self.run_test("""
+import numpy
+def expression_fusion_redefined(a, b, c):
+    out = numpy.empty_like(a)
+    t = a * b
+    t = t + c
+    out[:] = numpy.sqrt(t)
+    t = a[::-1] - b
+    a[1:] = t[:-1]
+    return out, a, t""",
+                      numpy.arange(10.), numpy.arange(10.) / 3, numpy.ones(10),
+                      expression_fusion_redefined=[numpy.array([float])] * 3)
+
     def test_full_unroll0(self):
         init = """
 def full_unroll0():
@@ -194,3 +194,8 @@ def are_equal(s1):
     def test_print_empty_set(self):
         self.run_test("def print_empty_set(s): return str(s)", set(), print_empty_set=[{int}])
 
+    def test_large_set_operations(self):
+        self.run_test("def large_set_operations(n):\n a = set(range(0, n, 2))\n b = set(range(0, n, 3))\n return sorted(a & b), sorted(a | b), sorted(a - b), sorted(a ^ b), len(a.intersection(b, range(0, n, 5)))", 10000, large_set_operations=[int])
+
+    def test_set_pop_all(self):
+        self.run_test("def set_pop_all(n):\n a = set(range(n))\n a.discard(n // 2)\n s = 0\n while a: s += a.pop()\n return s, len(a)", 10000, set_pop_all=[int])
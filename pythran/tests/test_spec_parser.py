@@ -126,3 +126,22 @@ def bar(i): return
 foo = 1
             '''
         self.assertTrue(pythran.spec_parser(code))
+
+    def test_nogil_export0(self):
+        code = '''
+#pythran export nogil foo(int)
+#pythran export foo(float)
+def foo(n): return n
+            '''
+        from pythran.spec import NoGILSignature
+        signatures = pythran.spec_parser(code)['foo']
+        self.assertEqual(len(signatures), 2)
+        self.assertIsInstance(signatures[0], NoGILSignature)
+        self.assertNotIsInstance(signatures[1], NoGILSignature)
+
+    def test_nogil_export1(self):
+        code = '''
+#pythran export nogil nogil(int)
+def nogil(n): return n
+            '''
+        self.assertIn('nogil', pythran.spec_parser(code))
@@ -77,6 +77,12 @@ class TestStr(TestEnv):
     def test_str_format(self):
         self.run_test("def str_format(a): return '%.2f %.2f' % (a, a)", 43.23, str_format=[float])
 
+    def test_str_startswith_bounds(self):
+        self.run_test("def str_startswith_bounds(s0, s1): return s0.startswith(s1, -4), s0.startswith(s1, 5), s0.startswith('', 9), s0.startswith(s1[0], 2)", "barbapapa", "pa", str_startswith_bounds=[str, str])
+
+    def test_str_join_separators(self):
+        self.run_test("def str_join_separators(a): return ','.join(a), '--'.join(a), ''.join(a)", ['ab', '', 'c', 'def'], str_join_separators=[[str]])
+
     def test_str_join0(self):
         self.run_test("def str_join0(): a = ['1'] ; a.pop() ; return 'e'.join(a)", str_join0=[])
 
@@ -108,3 +114,39 @@ class TestStr(TestEnv):
         self.run_test("def str_count(s, t, u, v): return s.count(t), s.count(u), s.count(v)",
                       "pythran is good for health", "py", "niet", "t",
                       str_count=[str, str, str, str])
+
+    def test_str_slice_negative_index(self):
+        self.run_test("def str_slice_negative_index(s): return s[1:][-1], s[::2][-2]",
+                      "pythran", str_slice_negative_index=[str])
+
+    def test_str_positive_index(self):
+        self.run_test("def str_positive_index(s): return [s[i] + s[i + 1] for i in range(len(s) - 1)]",
+                      "pythran", str_positive_index=[str])
+
+    def test_str_split_whitespace(self):
+        self.run_test("def str_split_whitespace(s): return s.split(), s.split(None, 1)",
+                      "  pythran  is\tgood \n", str_split_whitespace=[str])
+
+    def test_str_split_sep(self):
+        self.run_test("def str_split_sep(s): return s.split(','), s.split(', '), s.split(',', 1)",
+                      "a,, b, c,", str_split_sep=[str])
+
+    def test_str_strip_all(self):
+        self.run_test("def str_strip_all(s): return s.strip(), s.lstrip(), s.rstrip(), s[1:].find(' ')",
+                      "   ", str_strip_all=[str])
+
+    def test_str_replace_patterns(self):
+        self.run_test("def str_replace_patterns(s): return s.replace('a', 'bb'), s.replace('aa', '', 1), s.replace('', '-'), s.replace('z', 'y')",
+                      "aabaa", str_replace_patterns=[str])
+
+    def test_str_split_views(self):
+        self.run_test("def str_split_views(s):\n"
+                      " d = {}\n"
+                      " for line in s.split('\\n'):\n"
+                      "  kv = line.strip().split('=')\n"
+                      "  d[kv[0]] = int(kv[1])\n"
+                      " first = s.split('\\n')[0]\n"
+                      " copy = first\n"
+                      " copy += '!'\n"
+                      " return sorted(d.items()), first, copy, first[1:3], s",
+                      " a=1\nbb=22 \nc=3", str_split_views=[str])
@@ -5,6 +5,7 @@ a dynamic library, see __init__.py for exported interfaces.
 
 from pythran.backend import Cxx
 from pythran.config import cfg, make_extension
+from pythran import cache
 from pythran.cxxgen import PythonModule, Define, Include, Line, Statement
 from pythran.cxxgen import FunctionBody, FunctionDeclaration, Value, Block
 from pythran.middlend import refine
@@ -13,7 +14,7 @@ from pythran.tables import pythran_ward
 from pythran.types.types import extract_constructed_types
 from pythran.types.type_dependencies import pytype_to_deps
 from pythran.types.conversion import pytype_to_ctype
-from pythran.spec import expand_specs, specs_to_docstrings
+from pythran.spec import expand_specs, specs_to_docstrings, NoGILSignature
 from pythran.syntax import check_specs
 from pythran.version import __version__
 import pythran.frontend as frontend
@@ -32,6 +33,7 @@ import shutil
 import sys
 import glob
 import hashlib
+import time
 from functools import reduce
 
 logger = logging.getLogger('pythran')
@@ -55,6 +57,30 @@ numpy.distutils.ccompiler.replace_method(numpy.distutils.ccompiler.CCompiler,
                                          'customize', CCompiler_customize)
 
 
+# headers included first by all modules, they make up the precompiled header
+# along with the numpy ones
+def _common_includes():
+    return [Include("pythonic/core.hpp"),
+            Include("pythonic/python/core.hpp"),
+            # FIXME: only include these when needed
+            Include("pythonic/types/bool.hpp"),
+            Include("pythonic/types/int.hpp"),
+            Line("#ifdef _OPENMP\n#include <omp.h>\n#endif")]
+
+_NUMPY_INCLUDES = ("pythonic/include/types/ndarray.hpp",
+                   "pythonic/types/ndarray.hpp")
+
+
+def _precompiled_header(module):
+    ''' C++ code shared by `module' and the modules with the same preamble
+    and the same use of numpy. '''
+    header = module.preamble + _common_includes()
+    filenames = [getattr(inc, 'filename', None) for inc in module.includes]
+    if all(inc in filenames for inc in _NUMPY_INCLUDES):
+        header.extend(Include(inc) for inc in _NUMPY_INCLUDES)
+    return '\n'.join(str(line) for line in header) + '\n'
+
+
 def _extract_all_constructed_types(v):
     return sorted(set(reduce(lambda x, y: x + y,
                              (extract_constructed_types(t) for t in v), [])),
@@ -160,21 +186,22 @@ def generate_cxx(module_name, code, specs=None, optimizations=None):
 
         mod = PythonModule(module_name, docstrings, metainfo)
         mod.add_to_preamble(Define("BOOST_SIMD_NO_STRICT_ALIASING", "1"))
-        mod.add_to_includes(
-            Include("pythonic/core.hpp"),
-            Include("pythonic/python/core.hpp"),
-            # FIXME: only include these when needed
-            Include("pythonic/types/bool.hpp"),
-            Include("pythonic/types/int.hpp"),
-            Line("#ifdef _OPENMP\n#include <omp.h>\n#endif")
-        )
+        mod.add_to_includes(*_common_includes())
         mod.add_to_includes(*[Include(inc) for inc in
                               _extract_specs_dependencies(specs)])
         mod.add_to_includes(*content.body)
         mod.add_to_includes(
             Include("pythonic/python/exception_handler.hpp"),
+            Include("pythonic/python/dispatch.hpp"),
         )
 
+        release_gil = cfg.getboolean('pythran', 'nogil')
+        if release_gil or any(isinstance(signature, NoGILSignature)
+                              for signatures in specs.values()
+                              for signature in signatures):
+            # objects shared between calls now need atomic reference counts
+            mod.add_to_preamble(Define("PYTHRAN_NOGIL", "1"))
+
         for function_name, signatures in specs.items():
             internal_func_name = renamings.get(function_name,
                                                function_name)
@@ -213,7 +240,8 @@ def generate_cxx(module_name, code, specs=None, optimizations=None):
                             ', '.join(arguments)))])
                     ),
                     function_name,
-                    arguments_types
+                    arguments_types,
+                    release_gil or isinstance(signature, NoGILSignature)
                 )
     return mod
 
@@ -298,22 +326,48 @@ def compile_pythrancode(module_name, pythrancode, specs=None,
     if specs is None:
         specs = spec_parser(pythrancode)
 
-    # Generate C++, get a PythonModule object
-    module = generate_cxx(module_name, pythrancode, specs, opts)
-
     if cpponly:
+        # Generate C++, get a PythonModule object
+        module = generate_cxx(module_name, pythrancode, specs, opts)
         # User wants only the C++ code
         _, tmp_file = _get_temp(str(module))
         if not output_file:
             output_file = module_name + ".cpp"
         shutil.move(tmp_file, output_file)
         logger.info("Generated C++ source file: " + output_file)
-    else:
-        # Compile to binary
-        output_file = compile_cxxcode(module_name,
-                                      str(module.generate()),
-                                      output_binary=output_file,
-                                      **kwargs)
+        return output_file
+
+    keep_temp = kwargs.pop('keep_temp', False)
+    extension = make_extension(**kwargs)
+
+    # Reuse a previous build of the same module
+    key = None
+    if cache.enabled():
+        key = cache.build_key(module_name, pythrancode, specs, opts,
+                              extension)
+        cached = key and cache.lookup(key, module_name, output_file)
+        if cached:
+            return cached
+
+    start = time.time()
+
+    # Generate C++, get a PythonModule object
+    module = generate_cxx(module_name, pythrancode, specs, opts)
+
+    if cfg.getboolean('cache', 'pch'):
+        kwargs['extra_compile_args'] = (
+            list(kwargs.get('extra_compile_args', ())) +
+            cache.precompiled_header(_precompiled_header(module), extension))
+
+    # Compile to binary
+    output_file = compile_cxxcode(module_name,
+                                  str(module.generate()),
+                                  output_binary=output_file,
+                                  keep_temp=keep_temp,
+                                  **kwargs)
+
+    if key:
+        cache.store(key, module_name, output_file, time.time() - start)
 
     return output_file
 
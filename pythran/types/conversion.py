@@ -58,9 +58,10 @@ def pytype_to_ctype(t):
         # the trick is to use transposed array of two elements for texpr
         if t.flags.f_contiguous and not t.flags.c_contiguous and ndim == 2:
             return 'pythonic::types::numpy_texpr<{0}>'.format(arr)
-        elif any(x < 0 for x in t.strides):
-            slices = ", ".join(['pythonic::types::slice'] * ndim)
-            return 'pythonic::types::numpy_gexpr<{0},{1}>'.format(arr, slices)
+        # other non-contiguous layouts are viewed through their strides
+        elif ((t.flags.f_contiguous and not t.flags.c_contiguous) or
+              any(x < 0 for x in t.strides)):
+            return 'pythonic::types::numpy_sexpr<{0},{1}>'.format(dtype, ndim)
         else:
             return arr
     elif t in PYTYPE_TO_CTYPE_TABLE:
@@ -88,7 +89,7 @@ def pytype_to_pretty_type(t):
         arr = '{0}{1}'.format(dtype, '[]' * ndim)
         # cannot use f_contiguous as one element arrays are both c_ and f_
         # the trick is to use transposed array of two elements for texpr
-        if t.flags.f_contiguous and not t.flags.c_contiguous and ndim == 2:
+        if t.flags.f_contiguous and not t.flags.c_contiguous:
             return '{}.T'.format(arr)
         elif any(x < 0 for x in t.strides):
             return '{0}{1}'.format(dtype, '[::]' * ndim)
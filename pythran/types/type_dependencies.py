@@ -29,8 +29,12 @@ def pytype_to_deps_hpp(t):
     elif isinstance(t, ndarray):
         out = {'ndarray.hpp'}
         # it's a transpose!
-        if t.flags.f_contiguous and not t.flags.c_contiguous:
+        if t.flags.f_contiguous and not t.flags.c_contiguous and t.ndim == 2:
             out.add('numpy_texpr.hpp')
+        # it's a strided view!
+        elif ((t.flags.f_contiguous and not t.flags.c_contiguous) or
+              any(x < 0 for x in t.strides)):
+            out.add('numpy_sexpr.hpp')
         return out.union(pytype_to_deps_hpp(t[0]))
     elif t in PYTYPE_TO_CTYPE_TABLE:
         return {'{}.hpp'.format(t.__name__)}
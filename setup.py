@@ -25,7 +25,7 @@ except ImportError:
     raise
 
 from setuptools.command.build_py import build_py
-from setuptools import setup
+from setuptools import setup, Command
 from distutils import ccompiler
 from distutils.errors import CompileError, LinkError
 from setuptools.command.test import test as TestCommand
@@ -81,6 +81,57 @@ class PyTest(TestCommand):
         sys.exit(errno)
 
 
+class BenchmarkCommand(Command):
+
+    """
+    Run the benchmark suite: time each test case carrying a ``#bench`` line,
+    see ``pythran/tests/bench.py``.
+    """
+
+    description = 'run the benchmark suite'
+    user_options = [
+        ('mode=', None,
+         'comma separated list of modes among python, pythran, pythran+omp '
+         'and reference (default python,pythran)'),
+        ('nb-iter=', None, 'number of repetitions of each workload'),
+        ('cases=', None, 'comma separated list of cases to run (default all)'),
+        ('cxxflags=', None, 'extra compiler flags for compiled modes'),
+        ('reference-flags=', None,
+         'extra compiler flags for the reference mode'),
+        ('output=', 'o', 'write the JSON report to that file'),
+        ('baseline=', None, 'JSON report to compare the timings with'),
+        ('threshold=', None, 'slowdown ratio reported as a regression'),
+    ]
+
+    def initialize_options(self):
+        self.mode = None
+        self.nb_iter = None
+        self.cases = None
+        self.cxxflags = None
+        self.reference_flags = None
+        self.output = None
+        self.baseline = None
+        self.threshold = None
+
+    def finalize_options(self):
+        pass
+
+    def run(self):
+        sys.path.insert(0, os.getcwd())
+        sys.path.insert(0, os.path.join(os.getcwd(), 'pythran', 'tests'))
+        import bench
+        argv = (self.cases or '').split(',')
+        for option in ('mode', 'nb_iter', 'cxxflags', 'reference_flags',
+                       'output', 'baseline', 'threshold'):
+            value = getattr(self, option)
+            if value is not None:
+                argv.append('--{}={}'.format(option.replace('_', '-'),
+                                             value))
+        errno = bench.main([arg for arg in argv if arg])
+        if errno:
+            sys.exit(errno)
+
+
 class BuildWithThirdParty(build_py):
 
     """
@@ -213,4 +264,5 @@ setup(name='pythran',
                     },
       tests_require=['pytest', 'pytest-pep8'],
       test_suite="pythran/test",
-      cmdclass={'build_py': BuildWithThirdParty, 'test': PyTest})
+      cmdclass={'build_py': BuildWithThirdParty, 'test': PyTest,
+                'bench': BenchmarkCommand})